@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ArcBench {
+
+	// keeps the compiler from throwing away the work that produced value
+	template <class T>
+	inline void DoNotOptimize(const T& value) {
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+	#else
+		static volatile const void* sink;
+		sink = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	#endif
+	}
+
+	struct Options {
+		std::string filter;			// only run benchmarks whose name contains this
+		std::string format = "json";	// json or csv
+		double minSampleTime = 0.02;	// seconds each sample should at least take
+		std::size_t samples = 7;
+	};
+
+	struct Result {
+		std::string name;
+		std::size_t items = 0;			// units of work in one iteration (vertices, quads, draws, ...)
+		std::uint64_t iterations = 0;	// iterations in one sample
+		double medianNs = 0.0;			// per iteration
+		double minNs = 0.0;				// per iteration
+	};
+
+	// NOTE:
+	// - every benchmark is calibrated until one sample takes at least minSampleTime,
+	//   then timed for the requested number of samples. the median and the fastest
+	//   sample are reported per iteration and per item
+	class Runner {
+	public:
+
+		explicit Runner(const Options& options) : m_options(options) {}
+
+		template <class F>
+		void Run(const std::string& name, const std::size_t items, F&& func) {
+			if (!m_options.filter.empty() && name.find(m_options.filter) == std::string::npos) { return; }
+
+			std::uint64_t iterations = 1;
+			while (true) {
+				const double time = Time(iterations, func);
+				if (time >= m_options.minSampleTime || iterations >= (std::uint64_t(1) << 40)) { break; }
+				const double scale = time > 0.0 ? std::min(10.0, 1.2 * m_options.minSampleTime / time) : 10.0;
+				iterations = std::max(iterations + 1, static_cast<std::uint64_t>(static_cast<double>(iterations) * scale));
+			}
+
+			std::vector<double> samples(std::max<std::size_t>(m_options.samples, 1));
+			for (double& sample : samples) {
+				sample = 1.0e9 * Time(iterations, func) / static_cast<double>(iterations);
+			}
+			std::sort(samples.begin(), samples.end());
+
+			Result result;
+			result.name = name;
+			result.items = items;
+			result.iterations = iterations;
+			result.medianNs = samples[samples.size() / 2];
+			result.minNs = samples.front();
+			m_results.push_back(result);
+		}
+
+		void Report(std::ostream& stream) const {
+			if (m_options.format == "csv") {
+				stream << "name,items,iterations,median_ns,min_ns,median_ns_per_item\n";
+				for (const Result& r : m_results) {
+					stream << r.name << "," << r.items << "," << r.iterations << "," << r.medianNs << "," << r.minNs << "," << r.medianNs / static_cast<double>(std::max<std::size_t>(r.items, 1)) << "\n";
+				}
+				return;
+			}
+			stream << "{\n\"samples\": " << m_options.samples << ",\n\"benchmarks\": [";
+			for (std::size_t i = 0; i < m_results.size(); ++i) {
+				const Result& r = m_results[i];
+				stream << (i == 0 ? "\n" : ",\n") << "\t{ \"name\": \"" << r.name << "\", \"items\": " << r.items << ", \"iterations\": " << r.iterations
+					<< ", \"median_ns\": " << r.medianNs << ", \"min_ns\": " << r.minNs << ", \"median_ns_per_item\": " << r.medianNs / static_cast<double>(std::max<std::size_t>(r.items, 1)) << " }";
+			}
+			stream << "\n]\n}\n";
+		}
+
+	private:
+
+		template <class F>
+		static double Time(const std::uint64_t iterations, F& func) {
+			const auto start = std::chrono::steady_clock::now();
+			for (std::uint64_t i = 0; i < iterations; ++i) { func(); }
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		Options m_options;
+		std::vector<Result> m_results;
+	};
+
+	void VertexArrayBenchmarks(Runner& runner);
+
+	void QuadBenchmarks(Runner& runner);
+
+	void RandomBenchmarks(Runner& runner);
+
+	void PackedVertexBenchmarks(Runner& runner);
+
+	void ParticleBenchmarks(Runner& runner);
+
+	void SnapshotBenchmarks(Runner& runner);
+
+	void JobBenchmarks(Runner& runner);
+
+	void EmitterBenchmarks(Runner& runner);
+
+}
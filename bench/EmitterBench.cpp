@@ -0,0 +1,99 @@
+#include "Bench.hpp"
+#include "Arc/Emitter.hpp"
+#include <memory>
+#include <vector>
+
+// compares the compile time affector pipeline of Arc::Emitter against the same
+// affectors behind a virtual interface, called once per particle per affector
+
+namespace {
+
+	constexpr std::size_t ParticleCount = 1 << 16;
+	constexpr float FrameTime = 1.0f / 60.0f;
+
+	class VirtualAffector {
+	public:
+		virtual ~VirtualAffector() = default;
+		virtual void Apply(const Arc::ParticleSpan& particles, std::size_t i, float dt, float life) const = 0;
+	};
+
+	template <class A>
+	class VirtualAdapter final : public VirtualAffector {
+	public:
+		explicit VirtualAdapter(const A& affector) : m_affector(affector) {}
+		void Apply(const Arc::ParticleSpan& particles, const std::size_t i, const float dt, const float life) const override {
+			m_affector(particles, i, dt, life);
+		}
+	private:
+		A m_affector;
+	};
+
+	// the same loop as Arc::Emitter::Update() with the affectors chosen at runtime
+	class VirtualEmitter {
+	public:
+
+		template <class A>
+		void Add(const A& affector) {
+			m_affectors.push_back(std::make_unique<VirtualAdapter<A>>(affector));
+		}
+
+		void Update(Arc::ParticleArrays& p, const float dt) const {
+			const Arc::ParticleSpan particles = { p.positions.data(), p.velocities.data(), p.sizes.data(), p.rotations.data(), p.spins.data(), p.ages.data(), p.lifetimes.data(), p.colors.data(), p.positions.size() };
+			for (std::size_t i = 0; i < particles.count; ++i) {
+				const float age = particles.ages[i] + dt;
+				particles.ages[i] = age;
+				const float life = std::min(age / particles.lifetimes[i], 1.0f);
+				for (const std::unique_ptr<VirtualAffector>& affector : m_affectors) { affector->Apply(particles, i, dt, life); }
+				particles.positions[i] += dt * particles.velocities[i];
+			}
+		}
+
+	private:
+		std::vector<std::unique_ptr<VirtualAffector>> m_affectors;
+	};
+
+	// lifetimes are long enough that no particle dies during the benchmark
+	Arc::ParticleSpawn MakeSpawn(const std::size_t i) {
+		Arc::ParticleSpawn spawn;
+		spawn.position = { static_cast<float>(i % 256) * 4.0f, static_cast<float>(i / 256) * 4.0f };
+		spawn.velocity = { static_cast<float>(i % 7) * 10.0f - 30.0f, -200.0f };
+		spawn.spin = 90.0f;
+		spawn.lifetime = 1.0e6f;
+		return spawn;
+	}
+
+}
+
+void ArcBench::EmitterBenchmarks(Runner& runner) {
+	using ArcBench::DoNotOptimize;
+	const Arc::Gravity gravity{ { 0.0f, 400.0f } };
+	const Arc::Drag drag{ 0.5f };
+	const Arc::ColorOverLife colorOverLife{ sf::Color::Yellow, sf::Color::Transparent };
+	const Arc::Spin spin{};
+	const std::string suffix = "/" + std::to_string(ParticleCount);
+
+	Arc::Emitter<Arc::Gravity, Arc::Drag, Arc::ColorOverLife, Arc::Spin> emitter(gravity, drag, colorOverLife, spin);
+	emitter.Reserve(ParticleCount);
+	for (std::size_t i = 0; i < ParticleCount; ++i) { emitter.Emit(MakeSpawn(i)); }
+	runner.Run("Emitter/Fused" + suffix, ParticleCount, [&] {
+		emitter.Update(FrameTime);
+		DoNotOptimize(emitter.GetParticles().positions[0]);
+	});
+
+	Arc::ParticleArrays particles = emitter.GetParticles();
+	VirtualEmitter virtualEmitter;
+	virtualEmitter.Add(gravity);
+	virtualEmitter.Add(drag);
+	virtualEmitter.Add(colorOverLife);
+	virtualEmitter.Add(spin);
+	runner.Run("Emitter/Virtual" + suffix, ParticleCount, [&] {
+		virtualEmitter.Update(particles, FrameTime);
+		DoNotOptimize(particles.positions[0]);
+	});
+
+	std::vector<sf::Vertex> vertices(4 * ParticleCount);
+	runner.Run("Emitter/WriteQuads" + suffix, ParticleCount, [&] {
+		emitter.WriteQuads(vertices, 0);
+		DoNotOptimize(vertices[0]);
+	});
+}
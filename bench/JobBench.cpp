@@ -0,0 +1,89 @@
+#include "Bench.hpp"
+#include "Arc/JobSystem.hpp"
+#include "Arc/QuadUtils.hpp"
+#include "Arc/VertexArrayUtils.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t JobCount = 1000;
+	constexpr std::size_t QuadCount = 1 << 18;
+
+	// 1, 2, 4, ... up to every core, and every core itself when that is not a power of two
+	std::vector<unsigned> GetThreadCounts() {
+		const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+		std::vector<unsigned> counts;
+		for (unsigned count = 1; count < cores; count *= 2) { counts.push_back(count); }
+		counts.push_back(cores);
+		return counts;
+	}
+
+}
+
+void ArcBench::JobBenchmarks(Runner& runner) {
+	using ArcBench::DoNotOptimize;
+
+	// scheduling overhead. the jobs do nothing so this is the cost of a job from Schedule() to Wait()
+	for (const unsigned threads : GetThreadCounts()) {
+		Arc::JobSystem jobs(threads);
+		const std::string suffix = "/t" + std::to_string(threads);
+		std::atomic<std::size_t> sink{ 0 };
+		std::vector<Arc::JobHandle> handles;
+		handles.reserve(JobCount);
+
+		runner.Run("JobSystem/ScheduleWait" + suffix, JobCount, [&] {
+			handles.clear();
+			for (std::size_t i = 0; i < JobCount; ++i) {
+				handles.push_back(jobs.Schedule([&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }));
+			}
+			for (const Arc::JobHandle& handle : handles) { jobs.Wait(handle); }
+		});
+
+		runner.Run("JobSystem/Chain" + suffix, JobCount, [&] {
+			Arc::JobHandle last;
+			for (std::size_t i = 0; i < JobCount; ++i) {
+				last = jobs.Schedule([&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }, { last });
+			}
+			jobs.Wait(last);
+		});
+
+		runner.Run("JobSystem/ParallelForEmpty" + suffix, JobCount, [&] {
+			jobs.ParallelFor(JobCount, 1, [&sink](const std::size_t begin, const std::size_t end) {
+				sink.fetch_add(end - begin, std::memory_order_relaxed);
+			});
+		});
+		DoNotOptimize(sink.load());
+	}
+
+	// scaling of the range kernels split over the job system
+	std::vector<sf::Vertex> vertices(4 * QuadCount);
+	Arc::MakeGrid(vertices, 0, { 512, 512 }, { 8.0f, 8.0f }, {}, { 2.0f, 2.0f });
+	const std::size_t n = vertices.size();
+	for (const unsigned threads : GetThreadCounts()) {
+		Arc::JobSystem jobs(threads);
+		const std::string suffix = "/t" + std::to_string(threads) + "/" + std::to_string(n);
+
+		runner.Run("JobSystem/MoveVertexArray" + suffix, n, [&] {
+			jobs.ParallelFor(n, 0, [&](const std::size_t begin, const std::size_t end) {
+				Arc::MoveVertexArray(vertices, begin, end - begin, { 0.5f, -0.5f });
+			});
+			DoNotOptimize(vertices[0]);
+		});
+
+		runner.Run("JobSystem/RotateVertexArray" + suffix, n, [&] {
+			jobs.ParallelFor(n, 0, [&](const std::size_t begin, const std::size_t end) {
+				Arc::RotateVertexArray(vertices, begin, end - begin, 1.0f, { 2560.0f, 2560.0f });
+			});
+			DoNotOptimize(vertices[0]);
+		});
+
+		runner.Run("JobSystem/SetVertexArrayColor" + suffix, n, [&] {
+			jobs.ParallelFor(n, 0, [&](const std::size_t begin, const std::size_t end) {
+				Arc::SetVertexArrayColor(vertices, begin, end - begin, sf::Color::Red);
+			});
+			DoNotOptimize(vertices[0]);
+		});
+	}
+}
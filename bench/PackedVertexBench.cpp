@@ -0,0 +1,51 @@
+#include "Bench.hpp"
+#include "Arc/PackedVertex.hpp"
+#include "Arc/QuadUtils.hpp"
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t QuadCount = 1 << 14;
+
+	template <class V>
+	void Suite(ArcBench::Runner& runner, const std::string& format) {
+		using ArcBench::DoNotOptimize;
+		std::vector<V> vertices(4 * QuadCount);
+		std::vector<sf::Vertex> expanded(4 * QuadCount);
+		std::vector<sf::Color> palette(256, sf::Color::White);
+		Arc::MakeGrid(vertices, 0, { 128, 128 }, { 8.0f, 8.0f }, {}, { 2.0f, 2.0f });
+		const std::string suffix = "/" + format + "/" + std::to_string(4 * QuadCount);
+		const std::size_t n = 4 * QuadCount;
+		float sign = 1.0f;
+
+		runner.Run("PackedVertex/MoveVertexArray" + suffix, n, [&] {
+			Arc::MoveVertexArray(vertices, 0, n, { sign, -sign });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("PackedVertex/RotateVertexArray" + suffix, n, [&] {
+			Arc::RotateVertexArray(vertices, 0, n, 15.0f * sign, { 512.0f, 512.0f });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("PackedVertex/MoveQuad" + suffix, n, [&] {
+			for (std::size_t i = 0; i < QuadCount; ++i) { Arc::MoveQuad(vertices, i, { sign, sign }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		if constexpr (!std::is_same_v<V, sf::Vertex>) {
+			runner.Run("PackedVertex/ExpandVertices" + suffix, n, [&] {
+				Arc::ExpandVertices(vertices.data(), n, expanded.data(), { 1024.0f, 1024.0f }, palette.data());
+				DoNotOptimize(expanded[0]);
+			});
+		}
+	}
+
+}
+
+void ArcBench::PackedVertexBenchmarks(Runner& runner) {
+	Suite<sf::Vertex>(runner, "Vertex");
+	Suite<Arc::FixedVertex>(runner, "FixedVertex");
+	Suite<Arc::HalfVertex>(runner, "HalfVertex");
+	Suite<Arc::PalettedVertex>(runner, "PalettedVertex");
+}
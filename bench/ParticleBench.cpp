@@ -0,0 +1,141 @@
+#include "Bench.hpp"
+#include "Arc/Arc.hpp"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <vector>
+
+// a headless copy of the particle system in examples/particles. the keys are
+// replaced by a fixed emission schedule and the frame time is fixed so every
+// run simulates exactly the same frames
+
+namespace {
+
+	struct ParticleInfo {
+		sf::Vector2f position, velocity, acceleration, size;
+		sf::Vector2f orientation = { 1.0f, 0.0f };
+		float rotationSpeed = 0.0f;
+		sf::Color color = sf::Color::Green;
+		sf::Time lifespan = sf::seconds(1.0f);
+	};
+
+	class Particle {
+	public:
+
+		template <class V>
+		void emit(V& vertices, const std::size_t index, const ParticleInfo& info) {
+			Arc::MakeQuad(vertices, index, info.position, info.size);
+			Arc::ApplyQuadTransform(vertices, index, Arc::Affine2::Rotation(info.orientation.y, info.orientation.x, info.position));
+			Arc::SetQuadColor(vertices, index, info.color);
+			velocity = info.velocity;
+			acceleration = info.acceleration;
+			rotationSpeed = info.rotationSpeed;
+			lifespan = info.lifespan;
+		}
+
+		template <class V>
+		void update(V& vertices, const std::size_t index, const sf::Time& ts) {
+			lifespan -= ts;
+			if (lifespan < sf::Time::Zero) {
+				Arc::SetQuadColor(vertices, index, sf::Color::Transparent);
+				return;
+			}
+			const float dt = ts.asSeconds();
+			velocity += dt * acceleration;
+			Arc::MoveQuad(vertices, index, dt * velocity);
+			Arc::RotateQuad(vertices, index, dt * rotationSpeed);
+		}
+
+	private:
+		sf::Vector2f velocity, acceleration;
+		float rotationSpeed = 0.0f;
+		sf::Time lifespan;
+	};
+
+	template <class V>
+	class ParticleSimulation {
+	public:
+
+		explicit ParticleSimulation(const std::size_t size) : m_particles(size) {
+			m_vertices.resize(4 * size);
+			m_rng.Seed(42);
+			Arc::SetVertexArrayColor(m_vertices, 0, 4 * size, sf::Color::Transparent);
+		}
+
+		void step() {
+			const sf::Vector2f origin = { 512.0f, 360.0f };
+			if (m_frame % 3 == 0) {
+				const sf::Vector2f phase = Arc::UnitVector(Arc::Degrees(0.2f * static_cast<float>(m_frame)));
+				for (std::size_t i = 0; i < m_sh1.size(); ++i) {
+					const sf::Vector2f dir = m_sh1.Rotate(i, phase);
+					emit(origin, { 30.0f, 10.0f }, sf::Color::Green, 200.0f * dir, 800.0f * dir, dir);
+				}
+			}
+			if (m_frame % 30 == 0) {
+				const sf::Vector2f phase = Arc::UnitVector(Arc::Degrees(m_rng(0.0f, 360.0f)));
+				for (std::size_t i = 0; i < m_sh2.size(); ++i) {
+					const sf::Vector2f dir = m_sh2.Rotate(i, phase);
+					emit(origin, { 30.0f, 30.0f }, sf::Color::Yellow, 300.0f * dir, 400.0f * dir, dir);
+				}
+			}
+			if (m_frame % 18 == 0) {
+				const sf::Vector2f phase = Arc::UnitVector(Arc::Degrees(m_rng(0.0f, 360.0f)));
+				for (std::size_t i = 0; i < m_sh3.size(); ++i) {
+					const sf::Vector2f dir = m_sh3.Rotate(i, phase);
+					for (int j = 1; j <= 5; ++j) {
+						emit(origin, { 10.0f, 50.0f }, sf::Color::Cyan, 100.0f * static_cast<float>(j) * dir, 400.0f * dir, dir);
+					}
+				}
+			}
+			const sf::Time dt = sf::microseconds(16667);
+			for (std::size_t i = 0; i < m_particles.size(); ++i) {
+				m_particles[i].update(m_vertices, i, dt);
+			}
+			++m_frame;
+		}
+
+		const V& getVertices() const { return m_vertices; }
+
+	private:
+
+		void emit(const sf::Vector2f& position, const sf::Vector2f& size, const sf::Color& color, const sf::Vector2f& velocity, const sf::Vector2f& acceleration, const sf::Vector2f& orientation) {
+			ParticleInfo info;
+			info.position = position;
+			info.size = size;
+			info.color = color;
+			info.lifespan = sf::seconds(3.0f);
+			info.velocity = velocity;
+			info.acceleration = acceleration;
+			info.orientation = orientation;
+			m_particles[m_index].emit(m_vertices, m_index, info);
+			++m_index;
+			if (m_index == m_particles.size()) { m_index = 0; }
+		}
+
+		static constexpr Arc::RadialTable<10> m_sh1 = {};
+		static constexpr Arc::RadialTable<60> m_sh2 = {};
+		static constexpr Arc::RadialTable<20> m_sh3 = {};
+
+		V m_vertices;
+		std::vector<Particle> m_particles;
+		std::size_t m_index = 0;
+		std::size_t m_frame = 0;
+		Arc::RNG m_rng;
+	};
+
+	template <class V>
+	void Suite(ArcBench::Runner& runner, const std::string& container) {
+		for (const std::size_t count : { std::size_t(3000), std::size_t(30000) }) {
+			ParticleSimulation<V> simulation(count);
+			for (int i = 0; i < 180; ++i) { simulation.step(); } // fill the pool before timing
+			runner.Run("Particles/Frame/" + container + "/" + std::to_string(count), count, [&] {
+				simulation.step();
+				ArcBench::DoNotOptimize(simulation.getVertices()[0]);
+			});
+		}
+	}
+
+}
+
+void ArcBench::ParticleBenchmarks(Runner& runner) {
+	Suite<std::vector<sf::Vertex>>(runner, "vector");
+	Suite<sf::VertexArray>(runner, "VertexArray");
+}
@@ -0,0 +1,178 @@
+#include "Bench.hpp"
+#include "Arc/QuadUtils.hpp"
+#include "Arc/TileMap.hpp"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t QuadCount = 1 << 14;
+
+	template <class V>
+	void Suite(ArcBench::Runner& runner, V& vertices, const std::string& container) {
+		using ArcBench::DoNotOptimize;
+		Arc::MakeGrid(vertices, 0, { 128, 128 }, { 8.0f, 8.0f }, {}, { 2.0f, 2.0f });
+		const std::string suffix = "/" + container + "/" + std::to_string(QuadCount);
+		const std::size_t n = QuadCount;
+		float sign = 1.0f;
+
+		// getters
+		runner.Run("QuadUtils/GetQuadCenter" + suffix, n, [&] {
+			sf::Vector2f sum;
+			for (std::size_t i = 0; i < n; ++i) { sum += Arc::GetQuadCenter(vertices, i); }
+			DoNotOptimize(sum);
+		});
+		runner.Run("QuadUtils/GetQuadSize" + suffix, n, [&] {
+			sf::Vector2f sum;
+			for (std::size_t i = 0; i < n; ++i) { sum += Arc::GetQuadSize(vertices, i); }
+			DoNotOptimize(sum);
+		});
+		runner.Run("QuadUtils/GetQuadRotation" + suffix, n, [&] {
+			float sum = 0.0f;
+			for (std::size_t i = 0; i < n; ++i) { sum += Arc::GetQuadRotation(vertices, i); }
+			DoNotOptimize(sum);
+		});
+		runner.Run("QuadUtils/GetQuadBounds" + suffix, n, [&] {
+			float sum = 0.0f;
+			for (std::size_t i = 0; i < n; ++i) { sum += Arc::GetQuadBounds(vertices, i).width; }
+			DoNotOptimize(sum);
+		});
+
+		// transforms
+		runner.Run("QuadUtils/MoveQuad" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::MoveQuad(vertices, i, { sign, sign }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/RotateQuad/center" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::RotateQuad(vertices, i, 5.0f * sign, { 512.0f, 512.0f }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/RotateQuad" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::RotateQuad(vertices, i, 5.0f); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/ScaleQuad/center" + suffix, n, [&] {
+			const sf::Vector2f factor = sign > 0.0f ? sf::Vector2f(2.0f, 2.0f) : sf::Vector2f(0.5f, 0.5f);
+			for (std::size_t i = 0; i < n; ++i) { Arc::ScaleQuad(vertices, i, factor, { 512.0f, 512.0f }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/ScaleQuad" + suffix, n, [&] {
+			const sf::Vector2f factor = sign > 0.0f ? sf::Vector2f(2.0f, 2.0f) : sf::Vector2f(0.5f, 0.5f);
+			for (std::size_t i = 0; i < n; ++i) { Arc::ScaleQuad(vertices, i, factor); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/TransformQuad/center" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::TransformQuad(vertices, i, { sign, sign }, 5.0f * sign, { 1.0f, 1.0f }, { 512.0f, 512.0f }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/TransformQuad" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::TransformQuad(vertices, i, { sign, sign }, 5.0f * sign, { 1.0f, 1.0f }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/ShearQuad/center" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::ShearQuad(vertices, i, { 0.0f, 0.25f * sign }, { 512.0f, 512.0f }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/ShearQuad" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::ShearQuad(vertices, i, { 0.0f, 0.25f * sign }); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		const Arc::Affine2 rotation = Arc::Affine2::Rotation(30.0f, { 512.0f, 512.0f });
+		const Arc::Affine2 inverse = rotation.GetInverse();
+		runner.Run("QuadUtils/ApplyQuadTransform" + suffix, n, [&] {
+			const Arc::Affine2& transform = sign > 0.0f ? rotation : inverse;
+			for (std::size_t i = 0; i < n; ++i) { Arc::ApplyQuadTransform(vertices, i, transform); }
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+
+		// setters
+		runner.Run("QuadUtils/SetQuadPosition" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::SetQuadPosition(vertices, i, { static_cast<float>(i % 128) * 10.0f, static_cast<float>(i / 128) * 10.0f }); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/SetQuadColor" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::SetQuadColor(vertices, i, sf::Color::Red); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/SetQuadTextureRect" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::SetQuadTextureRect(vertices, i, { 0.0f, 0.0f, 32.0f, 32.0f }); }
+			DoNotOptimize(vertices[0]);
+		});
+
+		// makers
+		runner.Run("QuadUtils/MakeRect" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::MakeRect(vertices, i, { static_cast<float>(i), 0.0f, 8.0f, 8.0f }); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/MakeQuad" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::MakeQuad(vertices, i, { static_cast<float>(i), 0.0f }, { 8.0f, 8.0f }); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/MakeDiamond" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::MakeDiamond(vertices, i, 8.0f, 8.0f, { static_cast<float>(i), 0.0f }); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("QuadUtils/MakeQuadLine" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::MakeQuadLine(vertices, i, { 0.0f, 0.0f }, { static_cast<float>(i), 100.0f }, 2.0f); }
+			DoNotOptimize(vertices[0]);
+		});
+		for (const unsigned int side : { 8u, 32u, 128u }) {
+			runner.Run("QuadUtils/MakeGrid/" + container + "/" + std::to_string(side) + "x" + std::to_string(side), side * side, [&] {
+				Arc::MakeGrid(vertices, 0, { side, side }, { 8.0f, 8.0f }, {}, { 2.0f, 2.0f });
+				DoNotOptimize(vertices[0]);
+			});
+		}
+
+		// tiles. the same map written per quad from rects and in one pass from a lut
+		std::vector<sf::FloatRect> rects;
+		for (unsigned int i = 0; i < 256; ++i) { rects.push_back({ static_cast<float>(i % 16) * 32.0f, static_cast<float>(i / 16) * 32.0f, 32.0f, 32.0f }); }
+		const std::vector<Arc::TileTexCoords> lut = Arc::MakeTileTexCoords(rects);
+		std::vector<std::uint16_t> ids(n);
+		for (std::size_t i = 0; i < n; ++i) { ids[i] = static_cast<std::uint16_t>((i * 37) % 256); }
+		runner.Run("QuadUtils/SetQuadTextureRect/tiles" + suffix, n, [&] {
+			for (std::size_t i = 0; i < n; ++i) { Arc::SetQuadTextureRect(vertices, i, rects[ids[i]]); }
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("TileMap/ApplyTileIds" + suffix, n, [&] {
+			Arc::ApplyTileIds(vertices, 0, ids, lut);
+			DoNotOptimize(vertices[0]);
+		});
+
+		// sorting. alternates between two shuffled key sets so every run has to move the quads
+		std::vector<std::uint16_t> keys[2] = { std::vector<std::uint16_t>(n), std::vector<std::uint16_t>(n) };
+		std::uint32_t state = 12345u;
+		for (std::vector<std::uint16_t>& set : keys) {
+			for (std::uint16_t& key : set) {
+				state = state * 1664525u + 1013904223u;
+				key = static_cast<std::uint16_t>(state >> 16);
+			}
+		}
+		std::vector<std::uint32_t> permutation, scratch;
+		std::vector<sf::Vertex> vertexScratch;
+		std::size_t set = 0;
+		runner.Run("QuadUtils/SortQuads" + suffix, n, [&] {
+			Arc::SortQuads(vertices, 0, n, keys[set].data(), permutation, scratch, vertexScratch);
+			set ^= 1;
+			DoNotOptimize(vertices[0]);
+		});
+	}
+
+}
+
+void ArcBench::QuadBenchmarks(Runner& runner) {
+	std::vector<sf::Vertex> vector(4 * QuadCount);
+	Suite(runner, vector, "vector");
+
+	sf::VertexArray array(sf::Quads, 4 * QuadCount);
+	Suite(runner, array, "VertexArray");
+}
@@ -0,0 +1,60 @@
+#include "Bench.hpp"
+#include "Arc/Random.hpp"
+
+namespace {
+
+	constexpr std::size_t DrawCount = 1024;
+
+}
+
+void ArcBench::RandomBenchmarks(Runner& runner) {
+	Arc::RNG rng;
+	rng.Seed(1234); // fixed so every run draws the same sequence
+	const std::string suffix = "/" + std::to_string(DrawCount);
+
+	runner.Run("Random/UniformDistribution/int" + suffix, DrawCount, [&] {
+		int sum = 0;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.UniformDistribution(0, 100); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/UniformDistribution/Uint8" + suffix, DrawCount, [&] {
+		unsigned int sum = 0;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.UniformDistribution<sf::Uint8>(0, 255); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/UniformDistribution/float" + suffix, DrawCount, [&] {
+		float sum = 0.0f;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.UniformDistribution(0.0f, 1.0f); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/UniformDistribution/double" + suffix, DrawCount, [&] {
+		double sum = 0.0;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.UniformDistribution(0.0, 1.0); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/NormalDistribution/float" + suffix, DrawCount, [&] {
+		float sum = 0.0f;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.NormalDistribution(0.0f, 1.0f); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/PointInLine/float" + suffix, DrawCount, [&] {
+		sf::Vector2f sum;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.PointInLine(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(100.0f, 50.0f)); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/PointInRect/float" + suffix, DrawCount, [&] {
+		sf::Vector2f sum;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.PointInRect(sf::FloatRect(0.0f, 0.0f, 100.0f, 50.0f)); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/PointInCircle/float" + suffix, DrawCount, [&] {
+		sf::Vector2f sum;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng.PointInCircle(0.0f, 100.0f, 0.0f, 360.0f); }
+		DoNotOptimize(sum);
+	});
+	runner.Run("Random/operator()/float" + suffix, DrawCount, [&] {
+		float sum = 0.0f;
+		for (std::size_t i = 0; i < DrawCount; ++i) { sum += rng(0.0f, 360.0f); }
+		DoNotOptimize(sum);
+	});
+}
@@ -0,0 +1,44 @@
+#include "Bench.hpp"
+#include "Arc/QuadUtils.hpp"
+#include "Arc/Snapshot.hpp"
+#include <cstring>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t QuadCount = 1 << 16;
+
+	// keeps the saved snapshot aligned so Restore measures the zero copy path
+	struct alignas(Arc::SnapshotAlignment) AlignedBlock {
+		unsigned char bytes[Arc::SnapshotAlignment];
+	};
+
+}
+
+void ArcBench::SnapshotBenchmarks(Runner& runner) {
+	using ArcBench::DoNotOptimize;
+	std::vector<sf::Vertex> vertices(4 * QuadCount);
+	Arc::MakeGrid(vertices, 0, { 256, 256 }, { 8.0f, 8.0f }, {}, { 2.0f, 2.0f });
+	Arc::SetVertexArrayColor(vertices, 0, vertices.size(), sf::Color::White);
+	const std::size_t n = vertices.size();
+
+	for (const bool compress : { false, true }) {
+		const std::string suffix = std::string(compress ? "/lz/" : "/raw/") + std::to_string(n);
+		Arc::SnapshotWriter writer;
+		runner.Run("Snapshot/Save" + suffix, n, [&] {
+			writer.Clear();
+			writer.AddVertices("vertices", vertices, 0, n, compress);
+			DoNotOptimize(writer.SaveToMemory());
+		});
+
+		const std::vector<unsigned char> bytes = writer.SaveToMemory();
+		std::vector<AlignedBlock> aligned((bytes.size() + sizeof(AlignedBlock) - 1) / sizeof(AlignedBlock));
+		std::memcpy(aligned.data(), bytes.data(), bytes.size());
+		Arc::SnapshotReader reader;
+		runner.Run("Snapshot/Restore" + suffix, n, [&] {
+			reader.LoadFromMemory(aligned.data(), bytes.size());
+			reader.ReadVertices("vertices", vertices, 0);
+			DoNotOptimize(vertices[0]);
+		});
+	}
+}
@@ -0,0 +1,107 @@
+#include "Bench.hpp"
+#include "Arc/VertexArrayUtils.hpp"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t VertexCount = 1 << 16;
+
+	template <class V>
+	void Fill(V& vertices) {
+		for (std::size_t i = 0; i < VertexCount; ++i) {
+			const float x = static_cast<float>(i % 256);
+			const float y = static_cast<float>(i / 256);
+			vertices[i] = sf::Vertex({ x, y }, sf::Color::White, { x, y });
+		}
+	}
+
+	template <class V>
+	void Suite(ArcBench::Runner& runner, V& vertices, V& other, const std::string& container) {
+		using ArcBench::DoNotOptimize;
+		Fill(vertices);
+		Fill(other);
+		const std::string suffix = "/" + container + "/" + std::to_string(VertexCount);
+		const std::size_t n = VertexCount;
+
+		// the transforms are chosen to undo each other in pairs so positions stay bounded
+		// however many iterations the runner picks
+		float sign = 1.0f;
+
+		runner.Run("VertexArrayUtils/MoveVertexArray" + suffix, n, [&] {
+			Arc::MoveVertexArray(vertices, 0, n, { sign, -sign });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/RotateVertexArray" + suffix, n, [&] {
+			Arc::RotateVertexArray(vertices, 0, n, 15.0f * sign, { 128.0f, 128.0f });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/ScaleVertexArray" + suffix, n, [&] {
+			Arc::ScaleVertexArray(vertices, 0, n, sign > 0.0f ? sf::Vector2f(2.0f, 2.0f) : sf::Vector2f(0.5f, 0.5f), { 128.0f, 128.0f });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/TransformVertexArray" + suffix, n, [&] {
+			Arc::TransformVertexArray(vertices, 0, n, { sign, sign }, 10.0f * sign, { 1.0f, 1.0f }, { 128.0f, 128.0f });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/ShearVertexArray" + suffix, n, [&] {
+			Arc::ShearVertexArray(vertices, 0, n, { 0.0f, 0.25f * sign }, { 128.0f, 128.0f });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/ReflectVertexArrayAlongX" + suffix, n, [&] {
+			Arc::ReflectVertexArrayAlongX(vertices, 0, n, { 128.0f, 128.0f });
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/ReflectVertexArrayAlongY" + suffix, n, [&] {
+			Arc::ReflectVertexArrayAlongY(vertices, 0, n, { 128.0f, 128.0f });
+			DoNotOptimize(vertices[0]);
+		});
+		const Arc::Affine2 rotation = Arc::Affine2::Rotation(30.0f, { 128.0f, 128.0f });
+		const Arc::Affine2 inverse = rotation.GetInverse();
+		runner.Run("VertexArrayUtils/ApplyTransform" + suffix, n, [&] {
+			Arc::ApplyTransform(vertices, 0, n, sign > 0.0f ? rotation : inverse);
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/SetVertexArrayColor" + suffix, n, [&] {
+			Arc::SetVertexArrayColor(vertices, 0, n, sign > 0.0f ? sf::Color::Red : sf::Color::Blue);
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/SetVertexArrayPosition" + suffix, n, [&] {
+			Arc::SetVertexArrayPosition(vertices, 0, n, { sign, sign });
+			sign = -sign;
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/GetVertexArrayBounds" + suffix, n, [&] {
+			const sf::FloatRect bounds = Arc::GetVertexArrayBounds(vertices, 0, n);
+			DoNotOptimize(bounds);
+		});
+		runner.Run("VertexArrayUtils/ResetVertexArray" + suffix, n, [&] {
+			Arc::ResetVertexArray(other, 0, n);
+			DoNotOptimize(other[0]);
+		});
+		runner.Run("VertexArrayUtils/SwapVertexArrays" + suffix, n, [&] {
+			Arc::SwapVertexArrays(vertices, 0, other, 0, n);
+			DoNotOptimize(vertices[0]);
+		});
+		runner.Run("VertexArrayUtils/SwapVertiesInArray" + suffix, n / 2, [&] {
+			Arc::SwapVertiesInArray(vertices, 0, n / 2, n / 2);
+			DoNotOptimize(vertices[0]);
+		});
+	}
+
+}
+
+void ArcBench::VertexArrayBenchmarks(Runner& runner) {
+	std::vector<sf::Vertex> vector(VertexCount), vectorOther(VertexCount);
+	Suite(runner, vector, vectorOther, "vector");
+
+	sf::VertexArray array(sf::Quads, VertexCount), arrayOther(sf::Quads, VertexCount);
+	Suite(runner, array, arrayOther, "VertexArray");
+}
@@ -0,0 +1,53 @@
+#include "Bench.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// usage: arc_bench [--filter=name] [--format=json|csv] [--samples=n] [--min-time=seconds] [--out=file]
+
+int main(int argc, char** argv) {
+
+	ArcBench::Options options;
+	std::string out;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		const std::size_t eq = arg.find('=');
+		const std::string key = arg.substr(0, eq);
+		const std::string value = eq == std::string::npos ? std::string() : arg.substr(eq + 1);
+		if (key == "--filter") { options.filter = value; }
+		else if (key == "--format") { options.format = value; }
+		else if (key == "--samples") { options.samples = static_cast<std::size_t>(std::strtoul(value.c_str(), nullptr, 10)); }
+		else if (key == "--min-time") { options.minSampleTime = std::strtod(value.c_str(), nullptr); }
+		else if (key == "--out") { out = value; }
+		else {
+			std::fprintf(stderr, "unknown argument: %s\n", arg.c_str());
+			return 1;
+		}
+	}
+
+	ArcBench::Runner runner(options);
+	ArcBench::VertexArrayBenchmarks(runner);
+	ArcBench::QuadBenchmarks(runner);
+	ArcBench::RandomBenchmarks(runner);
+	ArcBench::PackedVertexBenchmarks(runner);
+	ArcBench::ParticleBenchmarks(runner);
+	ArcBench::SnapshotBenchmarks(runner);
+	ArcBench::JobBenchmarks(runner);
+	ArcBench::EmitterBenchmarks(runner);
+
+	if (out.empty()) {
+		runner.Report(std::cout);
+	}
+	else {
+		std::ofstream file(out);
+		if (!file) {
+			std::fprintf(stderr, "could not open %s\n", out.c_str());
+			return 1;
+		}
+		runner.Report(file);
+	}
+	return 0;
+}
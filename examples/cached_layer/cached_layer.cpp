@@ -0,0 +1,122 @@
+#include "../example_list.hpp"
+#include "Arc/Arc.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdio>
+#include <vector>
+
+namespace ArcDemo {
+
+	namespace {
+
+		// draws the layer into a render texture and compares one pixel per expected color
+		bool CheckPixels(const Arc::CachedLayer& layer, sf::RenderTexture& target, const char* step, const std::vector<std::pair<sf::Vector2u, sf::Color>>& expected) {
+			target.clear(sf::Color::Transparent);
+			layer.Draw(target, sf::BlendNone);
+			target.display();
+			const sf::Image image = target.getTexture().copyToImage();
+			bool passed = true;
+			for (const auto& [pixel, color] : expected) {
+				const sf::Color actual = image.getPixel(pixel.x, pixel.y);
+				if (actual != color) {
+					std::printf("%s: pixel (%u, %u) is (%u, %u, %u, %u), expected (%u, %u, %u, %u)\n", step, pixel.x, pixel.y,
+						actual.r, actual.g, actual.b, actual.a, color.r, color.g, color.b, color.a);
+					passed = false;
+				}
+			}
+			return passed;
+		}
+
+	}
+
+	bool CachedLayerCheck() {
+		// a 96x64 layer split into a 64x64 and a 32x64 tile
+		Arc::CachedLayer layer;
+		sf::RenderTexture target;
+		if (!layer.Create({ 0.0f, 0.0f, 96.0f, 64.0f }, 64) || !target.create(96, 64)) {
+			std::printf("could not create the render textures\n");
+			return false;
+		}
+
+		// a red quad in the first tile, a blue one in the second and a green one over the seam
+		std::vector<sf::Vertex> vertices(12);
+		Arc::MakeRect(vertices, 0, { 8.0f, 8.0f, 16.0f, 16.0f });
+		Arc::MakeRect(vertices, 1, { 72.0f, 40.0f, 16.0f, 16.0f });
+		Arc::MakeRect(vertices, 2, { 56.0f, 40.0f, 16.0f, 8.0f });
+		Arc::SetQuadColor(vertices, 0, sf::Color::Red);
+		Arc::SetQuadColor(vertices, 1, sf::Color::Blue);
+		Arc::SetQuadColor(vertices, 2, sf::Color::Green);
+
+		bool passed = true;
+		layer.Update(vertices, 0, vertices.size(), sf::Quads);
+		passed &= CheckPixels(layer, target, "first update", {
+			{ { 8, 8 }, sf::Color::Red }, { { 23, 23 }, sf::Color::Red }, { { 24, 24 }, sf::Color::Transparent },
+			{ { 72, 40 }, sf::Color::Blue }, { { 87, 55 }, sf::Color::Blue },
+			{ { 63, 44 }, sf::Color::Green }, { { 64, 44 }, sf::Color::Green }, { { 40, 40 }, sf::Color::Transparent }
+		});
+
+		// move the red quad. the pixels it leaves must be cleared
+		layer.Invalidate(vertices, 0, 4);
+		Arc::MoveQuad(vertices, 0, { 20.0f, 3.0f });
+		layer.Invalidate(vertices, 0, 4);
+		// recolor the blue quad without invalidating it. the cached pixels must stay blue
+		Arc::SetQuadColor(vertices, 1, sf::Color::Yellow);
+		layer.Update(vertices, 0, vertices.size(), sf::Quads);
+		passed &= CheckPixels(layer, target, "partial update", {
+			{ { 8, 8 }, sf::Color::Transparent }, { { 27, 10 }, sf::Color::Transparent }, { { 28, 11 }, sf::Color::Red },
+			{ { 43, 26 }, sf::Color::Red }, { { 44, 27 }, sf::Color::Transparent },
+			{ { 72, 40 }, sf::Color::Blue }, { { 64, 44 }, sf::Color::Green }
+		});
+
+		// a region over the seam redraws both tiles, and only there. it is snapped out to (60, 38, 16, 4)
+		layer.Invalidate({ 60.4f, 38.2f, 15.2f, 3.6f });
+		Arc::SetQuadColor(vertices, 2, sf::Color::White);
+		layer.Update(vertices, 0, vertices.size(), sf::Quads);
+		passed &= CheckPixels(layer, target, "seam update", {
+			{ { 60, 40 }, sf::Color::White }, { { 71, 41 }, sf::Color::White }, { { 72, 41 }, sf::Color::Yellow }, { { 75, 40 }, sf::Color::Yellow },
+			{ { 59, 40 }, sf::Color::Green }, { { 60, 42 }, sf::Color::Green }, { { 76, 40 }, sf::Color::Blue }, { { 72, 42 }, sf::Color::Blue }
+		});
+
+		std::printf("cached layer check %s\n", passed ? "passed" : "failed");
+		return passed;
+	}
+
+	void CachedLayer() {
+		printf("\nThis is the Arc CachedLayer Demo\nClick to move the highlighted quad. Only the pixels it covers are drawn again\n");
+		sf::RenderWindow window({ 800, 600 }, "Cached Layer");
+		window.setFramerateLimit(60);
+
+		// a large static grid that is only drawn into the cache when part of it changes
+		const sf::Vector2u gridSize = { 160, 120 };
+		std::vector<sf::Vertex> vertices(4 * gridSize.x * gridSize.y);
+		Arc::MakeGrid(vertices, 0, gridSize, { 4.0f, 4.0f }, { 0.0f, 0.0f }, { 1.0f, 1.0f });
+		Arc::RNG rng;
+		for (std::size_t i = 0; i < vertices.size() / 4; ++i) {
+			Arc::SetQuadColor(vertices, i, sf::Color(rng.UniformDistribution<sf::Uint8>(0, 80), rng.UniformDistribution<sf::Uint8>(40, 160), rng.UniformDistribution<sf::Uint8>(80, 255)));
+		}
+		const std::size_t highlighted = 0;
+		Arc::SetQuadColor(vertices, highlighted, sf::Color::White);
+
+		Arc::CachedLayer layer;
+		if (!layer.Create({ 0.0f, 0.0f, 800.0f, 600.0f }, 256)) { return; }
+
+		while (window.isOpen()) {
+			sf::Event e;
+			while (window.pollEvent(e)) {
+				if (e.type == sf::Event::Closed) {
+					window.close();
+				}
+				else if (e.type == sf::Event::MouseButtonPressed) {
+					layer.Invalidate(vertices, 4 * highlighted, 4);
+					Arc::MakeQuad(vertices, highlighted, { static_cast<float>(e.mouseButton.x), static_cast<float>(e.mouseButton.y) }, { 16.0f, 16.0f });
+					layer.Invalidate(vertices, 4 * highlighted, 4);
+				}
+			}
+
+			layer.Update(vertices, 0, vertices.size(), sf::Quads);
+			window.clear();
+			layer.Draw(window);
+			window.display();
+		}
+	}
+
+}
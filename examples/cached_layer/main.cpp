@@ -0,0 +1,11 @@
+#include "../example_list.hpp"
+#include <cstring>
+
+// run with --check to only run the headless check. it needs no window, so with
+// LIBGL_ALWAYS_SOFTWARE=1 it runs on Mesa llvmpipe without a GPU
+int main(int argc, char** argv) {
+	if (argc > 1 && std::strcmp(argv[1], "--check") == 0) {
+		return ArcDemo::CachedLayerCheck() ? 0 : 1;
+	}
+	ArcDemo::CachedLayer();
+}
@@ -2,6 +2,10 @@
 
 namespace ArcDemo {
 
+	void CachedLayer();
+
+	bool CachedLayerCheck();
+
 	void Intro();
 
 	void Particles();
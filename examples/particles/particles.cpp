@@ -4,7 +4,8 @@
 
 struct ParticleInfo {
 	sf::Vector2f position, velocity, acceleration, size;
-	float rotation = 0.0f, rotationSpeed = 0.0f;
+	sf::Vector2f orientation = { 1.0f, 0.0f }; // unit vector along the length of the quad
+	float rotationSpeed = 0.0f;
 	sf::Color color = sf::Color::Green;
 	sf::Time lifespan = sf::seconds(1.0f);
 };
@@ -14,33 +15,35 @@ public:
 
 	Particle() = default;
 
-	void emit(sf::VertexArray& vertices, const std::size_t index, const ParticleInfo& info) {
-		Arc::MakeQuad(vertices, index, info.position, info.size);
-		Arc::RotateQuad(vertices, index, info.rotation);
-		Arc::SetQuadColor(vertices, index, info.color);
+	void emit(Arc::QuadPool& quads, const ParticleInfo& info) {
+		handle = quads.Allocate();
+		sf::Vertex* quad = quads.GetQuad(handle);
+		Arc::MakeQuad(quad, 0, info.position, info.size);
+		Arc::ApplyQuadTransform(quad, 0, Arc::Affine2::Rotation(info.orientation.y, info.orientation.x, info.position));
+		Arc::SetQuadColor(quad, 0, info.color);
 		velocity = info.velocity;
 		acceleration = info.acceleration;
 		rotationSpeed = info.rotationSpeed;
 		lifespan = info.lifespan;
 	}
 
-	void update(sf::VertexArray& vertices, const std::size_t index, const sf::Time& ts) {
+	// returns false once the particle has died and its quad was given back to the pool
+	bool update(Arc::QuadPool& quads, const sf::Time& ts) {
 		lifespan -= ts;
 		if (lifespan < sf::Time::Zero) {
-			Arc::SetQuadColor(vertices, index, sf::Color::Transparent);
-			return;
+			quads.Release(handle);
+			return false;
 		}
 		const float dt = ts.asSeconds();
 		velocity += dt * acceleration;
-		Arc::MoveQuad(vertices, index, dt * velocity);
-		Arc::RotateQuad(vertices, index, dt * rotationSpeed);
-	}
-
-	const bool isActive() const {
-		return lifespan < sf::Time::Zero;
+		sf::Vertex* quad = quads.GetQuad(handle);
+		Arc::MoveQuad(quad, 0, dt * velocity);
+		Arc::RotateQuad(quad, 0, dt * rotationSpeed);
+		return true;
 	}
 
 private:
+	Arc::QuadHandle handle;
 	sf::Vector2f velocity, acceleration;
 	float rotationSpeed = 0.0f;
 	sf::Time lifespan;
@@ -49,44 +52,44 @@ private:
 class ParticleSystem {
 public:
 
-	ParticleSystem() {
-		m_vertices.setPrimitiveType(sf::Quads);
-	}
-
-	void resize(const std::size_t size) {
-		m_vertices.resize(4 * size); // 4 * size because quads have 4 vertices
-		m_particles.resize(size);
-		reset();
-	}
+	ParticleSystem() = default;
 
 	void reset() {
-		m_index = 0;
-		std::fill(m_particles.begin(), m_particles.end(), Particle{});
-		Arc::SetVertexArrayColor(m_vertices, 0, m_vertices.getVertexCount(), sf::Color::Transparent);
+		m_particles.clear();
+		m_quads.Clear();
 	}
 
 	void emit(const ParticleInfo& info) {
-		m_particles[m_index].emit(m_vertices, m_index, info);
-		++m_index;
-		if (m_index == m_particles.size()) { m_index = 0; }
+		m_particles.emplace_back();
+		m_particles.back().emit(m_quads, info);
 	}
 
 	void update(const sf::Time& ts) {
-		for (std::size_t i = 0; i < m_particles.size(); ++i) {
-			m_particles[i].update(m_vertices, i, ts);
+		std::size_t i = 0;
+		while (i < m_particles.size()) {
+			if (m_particles[i].update(m_quads, ts)) { ++i; continue; }
+			m_particles[i] = m_particles.back();
+			m_particles.pop_back();
 		}
+		// the pool never moves live quads on its own so compact them once it gets sparse
+		if (m_quads.GetStats().occupancy < 0.5f) { m_quads.Defragment(); }
 	}
 
 	void draw(sf::RenderTarget& target) {
-		target.draw(&m_vertices[0], m_vertices.getVertexCount(), sf::Quads);
+		m_quads.Draw(target); // one draw call per chunk of 1024 quads
 	}
 
 private:
-	sf::VertexArray m_vertices; // in order to get the most out of batch rendering we need to use vertex arrays
+	Arc::QuadPool m_quads; // grows in chunks so live particles are never overwritten or copied
 	std::vector<Particle> m_particles;
-	std::size_t m_index = 0;
 };
 
+// the directions for each burst are computed at compile time and only
+// rotated by the burst's starting angle when emitting so there is no trig per particle
+static constexpr Arc::RadialTable<10> sh1_directions;
+static constexpr Arc::RadialTable<60> sh2_directions;
+static constexpr Arc::RadialTable<20> sh3_directions;
+
 void ArcDemo::Particles() {
 
 	std::printf("This is the Arc Particle Demo which shows some batch rendering capabilities of Arc\n");
@@ -99,7 +102,6 @@ void ArcDemo::Particles() {
 	Arc::RNG rng;
 	ParticleInfo info;
 	ParticleSystem system; // all particles will use only one particle system
-	system.resize(3000);
 
 	const sf::Time sh1_limit = sf::milliseconds(50);
 	sf::Time sh1_timer = sf::Time::Zero;
@@ -126,13 +128,12 @@ void ArcDemo::Particles() {
 			info.size = { 30.0f, 10.0f };
 			info.color = sf::Color::Green;
 			info.lifespan = sf::seconds(3.0f);
-			const float inc = (1.0f / 10.0f) * (2.0f * Arc::Pi_v<float>);
-			const float maxA = sh1_angle + (2.0f * Arc::Pi_v<float>);
-			for (float a = sh1_angle; a < maxA; a += inc) {
-				const float deg = Arc::Degrees(a);
-				info.velocity = 200.0f * Arc::UnitVector(deg);
-				info.acceleration = 800.0f * Arc::UnitVector(deg);
-				info.rotation = deg;
+			const sf::Vector2f phase = Arc::UnitVector(Arc::Degrees(sh1_angle));
+			for (std::size_t i = 0; i < sh1_directions.size(); ++i) {
+				const sf::Vector2f dir = sh1_directions.Rotate(i, phase);
+				info.velocity = 200.0f * dir;
+				info.acceleration = 800.0f * dir;
+				info.orientation = dir;
 				system.emit(info);
 			}
 			sh1_angle += 0.2f;
@@ -145,13 +146,12 @@ void ArcDemo::Particles() {
 			info.size = { 30.0f, 30.0f };
 			info.color = sf::Color::Yellow;
 			info.lifespan = sf::seconds(3.0f);
-			const float inc = (1.0f / 60.0f) * (2.0f * Arc::Pi_v<float>);
-			const float maxA = sh2_angle + (2.0f * Arc::Pi_v<float>);
-			for (float a = sh2_angle; a < maxA; a += inc) {
-				const float deg = Arc::Degrees(a);
-				info.velocity = 300.0f * Arc::UnitVector(deg);
-				info.acceleration = 400.0f * Arc::UnitVector(deg);
-				info.rotation = deg;
+			const sf::Vector2f phase = Arc::UnitVector(Arc::Degrees(sh2_angle));
+			for (std::size_t i = 0; i < sh2_directions.size(); ++i) {
+				const sf::Vector2f dir = sh2_directions.Rotate(i, phase);
+				info.velocity = 300.0f * dir;
+				info.acceleration = 400.0f * dir;
+				info.orientation = dir;
 				system.emit(info);
 			}
 			sh2_timer = sf::Time::Zero;
@@ -163,15 +163,14 @@ void ArcDemo::Particles() {
 			info.size = { 10.0f, 50.0f };
 			info.color = sf::Color::Cyan;
 			info.lifespan = sf::seconds(3.0f);
-			const float inc = (1.0f / 20.0f) * (2.0f * Arc::Pi_v<float>);
-			const float maxA = angle + (2.0f * Arc::Pi_v<float>);
-			for (float a = angle; a < maxA; a += inc) {
+			const sf::Vector2f phase = Arc::UnitVector(Arc::Degrees(angle));
+			for (std::size_t i = 0; i < sh3_directions.size(); ++i) {
+				const sf::Vector2f dir = sh3_directions.Rotate(i, phase);
 				float vel = 100.0f;
-				for (int i = 0; i < 5; ++i) {
-					const float deg = Arc::Degrees(a);
-					info.velocity = vel * Arc::UnitVector(deg);
-					info.acceleration = 400.0f * Arc::UnitVector(deg);
-					info.rotation = deg;
+				for (int j = 0; j < 5; ++j) {
+					info.velocity = vel * dir;
+					info.acceleration = 400.0f * dir;
+					info.orientation = dir;
 					system.emit(info);
 					vel += 100.0f;
 				}
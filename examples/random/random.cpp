@@ -28,21 +28,36 @@ namespace ArcDemo {
 		const double bern_rate = 0.8f;
 		const double weib_shape = 1.0f, weib_scale = 0.1f;
 
-		sf::Text intro, uniform, normal, bernoulli, weibull;
-
-		intro = sf::Text("press space to generate new random numbers", fonts.GetResource("vt323"), fontsize);
-
-		uniform = sf::Text("uniform distribution (a=" + std::to_string(unif_a) + ",b=" + std::to_string(unif_b) + "): " + std::to_string(rng(unif_a, unif_b)), fonts.GetResource("vt323"), fontsize);
-		uniform.setPosition({ 0.0f, 60.0f });
-
-		normal = sf::Text("normal distribution (mean=" + std::to_string(norm_mean) + ",stddev=" + std::to_string(norm_stddev) + "): " + std::to_string(rng.NormalDistribution(norm_mean, norm_stddev)), fonts.GetResource("vt323"), fontsize);
-		normal.setPosition({ 0.0f, 120.0f });
-
-		bernoulli = sf::Text("bernoulli distribution (success rate=" + std::to_string(bern_rate) + "): " + std::to_string(Arc::STLRand<std::bernoulli_distribution>(rng.GetGenerator(), bern_rate)), fonts.GetResource("vt323"), fontsize);
-		bernoulli.setPosition({ 0.0f, 180.0f });
-
-		weibull = sf::Text("weibull distribution (shape=" + std::to_string(weib_shape) + ",scale=" + std::to_string(weib_scale) + "): " + std::to_string(Arc::STLRand<std::weibull_distribution<double>>(rng.GetGenerator(), weib_shape, weib_scale)), fonts.GetResource("vt323"), fontsize);
-		weibull.setPosition({ 0.0f, 240.0f });
+		// all the labels share one glyph atlas and are drawn with one draw call
+		Arc::TextBatch text;
+		text.Create(fonts.GetResource("vt323"), fontsize);
+
+		const std::size_t intro = text.AddLabel({ 0.0f, 0.0f }, 64);
+		text.SetString(intro, "press space to generate new random numbers");
+
+		// the descriptions never change so they are built once. only the numbers after them are rewritten
+		const std::string uniformText = "uniform distribution (a=" + std::to_string(unif_a) + ",b=" + std::to_string(unif_b) + "): ";
+		const std::string normalText = "normal distribution (mean=" + std::to_string(norm_mean) + ",stddev=" + std::to_string(norm_stddev) + "): ";
+		const std::string bernoulliText = "bernoulli distribution (success rate=" + std::to_string(bern_rate) + "): ";
+		const std::string weibullText = "weibull distribution (shape=" + std::to_string(weib_shape) + ",scale=" + std::to_string(weib_scale) + "): ";
+
+		const std::size_t uniform = text.AddLabel({ 0.0f, 60.0f }, 96);
+		const std::size_t normal = text.AddLabel({ 0.0f, 120.0f }, 96);
+		const std::size_t bernoulli = text.AddLabel({ 0.0f, 180.0f }, 96);
+		const std::size_t weibull = text.AddLabel({ 0.0f, 240.0f }, 96);
+
+		// writes the description followed by the number into a stack buffer so nothing is allocated
+		auto setLabel = [&text](const std::size_t label, const std::string& description, const double value, const int decimals) {
+			char buffer[128];
+			std::size_t length = description.copy(buffer, sizeof(buffer));
+			length += Arc::FormatNumber(buffer + length, sizeof(buffer) - length, value, decimals);
+			text.SetString(label, { buffer, length });
+		};
+
+		setLabel(uniform, uniformText, rng(unif_a, unif_b), 6);
+		setLabel(normal, normalText, rng.NormalDistribution(norm_mean, norm_stddev), 6);
+		setLabel(bernoulli, bernoulliText, Arc::STLRand<std::bernoulli_distribution>(rng.GetGenerator(), bern_rate), 0);
+		setLabel(weibull, weibullText, Arc::STLRand<std::weibull_distribution<double>>(rng.GetGenerator(), weib_shape, weib_scale), 6);
 
 		while (window.isOpen()) {
 
@@ -54,21 +69,17 @@ namespace ArcDemo {
 					const double norm = rng.NormalDistribution(norm_mean, norm_stddev);
 					const bool bern = Arc::STLRand<std::bernoulli_distribution>(rng.GetGenerator(), bern_rate);
 					const double weib = Arc::STLRand<std::weibull_distribution<double>>(rng.GetGenerator(), weib_scale, weib_shape);
-					uniform.setString("uniform distribution (a=" + std::to_string(unif_a) + ",b=" + std::to_string(unif_b) + "): " + std::to_string(unif));
-					normal.setString("normal distribution (mean=" + std::to_string(norm_mean) + ",stddev=" + std::to_string(norm_stddev) + "): " + std::to_string(norm));
-					bernoulli.setString("bernoulli distribution (success rate=" + std::to_string(bern_rate) + "): " + std::to_string(bern));
-					weibull.setString("weibull distribution (shape=" + std::to_string(weib_shape) + ",scale=" + std::to_string(weib_scale) + "): " + std::to_string(weib));
+					setLabel(uniform, uniformText, unif, 6);
+					setLabel(normal, normalText, norm, 6);
+					setLabel(bernoulli, bernoulliText, bern, 0);
+					setLabel(weibull, weibullText, weib, 6);
 				}
 			}
 
 			if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) { window.close(); }
 
 			window.clear();
-			window.draw(intro);
-			window.draw(uniform);
-			window.draw(normal);
-			window.draw(bernoulli);
-			window.draw(weibull);
+			text.Draw(window);
 			window.display();
 
 		}
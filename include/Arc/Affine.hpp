@@ -0,0 +1,235 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			FACTORIES
+	------------------------------------------------------------
+	-	Identity()
+	-	Translation()
+	-	Rotation()
+	-	Scaling()
+	-	Shearing()
+	-	ReflectionAlongX()
+	-	ReflectionAlongY()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Translate()
+	-	Rotate()
+	-	Scale()
+	-	Shear()
+	-	ReflectAlongX()
+	-	ReflectAlongY()
+	-	Combine()
+	-	GetDeterminant()
+	-	GetInverse()
+	-	Apply()
+
+	------------------------------------------------------------
+			FREE FUNCTIONS
+	------------------------------------------------------------
+	-	TransformPoint()
+	-	Lerp()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		// the operations are applied in the order they are written so this
+		// rotates by 30 degrees, then scales by 2 and then shears
+		const Arc::Affine2 transform = Arc::Affine2().Rotate(30.0f).Scale({ 2.0f, 2.0f }).Shear({ 0.5f, 0.0f });
+
+		sf::Vector2f point = { 1.0f, 0.0f };
+		Arc::TransformPoint(point, transform);
+
+		// one pass over the vertices no matter how many operations were combined
+		sf::VertexArray vertices(sf::Quads, 400);
+		Arc::ApplyTransform(vertices, 0, vertices.getVertexCount(), transform);
+
+	}
+
+*/
+
+#include "Mathematics.hpp"
+
+namespace Arc {
+
+	// NOTE:
+	// - this is the 2x3 matrix
+	//
+	//		| a  b  tx |
+	//		| c  d  ty |
+	//
+	//   which maps a point p to (a * p.x + b * p.y + tx, c * p.x + d * p.y + ty)
+	// - the member functions that modify the transform append the operation so
+	//   it is applied after everything that is already in the transform
+	// - only the parts that do not take an sf::Vector2 are constexpr since
+	//   sf::Vector2 is not a literal type in SFML 2.5
+	template <typename F>
+	class BasicAffine2 {
+	public:
+
+		constexpr BasicAffine2() = default;
+
+		// the entries row by row, i.e. m00 = a, m01 = b, m02 = tx, m10 = c, m11 = d and m12 = ty
+		constexpr BasicAffine2(const F m00, const F m01, const F m02, const F m10, const F m11, const F m12) : a(m00), b(m01), tx(m02), c(m10), d(m11), ty(m12) {}
+
+		//////////////////////////////////////////////////////////////////////
+		//	FACTORIES
+		//////////////////////////////////////////////////////////////////////
+
+		static constexpr BasicAffine2 Identity() {
+			return {};
+		}
+
+		static BasicAffine2 Translation(const sf::Vector2<F>& translation) {
+			return { static_cast<F>(1), static_cast<F>(0), translation.x, static_cast<F>(0), static_cast<F>(1), translation.y };
+		}
+
+		static BasicAffine2 Rotation(const F sin, const F cos, const sf::Vector2<F>& center = {}) {
+			return About({ cos, -sin, static_cast<F>(0), sin, cos, static_cast<F>(0) }, center);
+		}
+
+		static BasicAffine2 Rotation(const F angle, const sf::Vector2<F>& center = {}) {
+			const F theta = Radians(angle);
+			return Rotation(std::sin(theta), std::cos(theta), center);
+		}
+
+		static BasicAffine2 Scaling(const sf::Vector2<F>& scaleFactor, const sf::Vector2<F>& center = {}) {
+			return About({ scaleFactor.x, static_cast<F>(0), static_cast<F>(0), static_cast<F>(0), scaleFactor.y, static_cast<F>(0) }, center);
+		}
+
+		// NOTE:
+		// - same shear as Arc::ShearPoint()
+		static BasicAffine2 Shearing(const sf::Vector2<F>& shearFactor, const sf::Vector2<F>& center = {}) {
+			return About({ static_cast<F>(1) + shearFactor.x * shearFactor.y, shearFactor.y, static_cast<F>(0), shearFactor.x, static_cast<F>(1), static_cast<F>(0) }, center);
+		}
+
+		static BasicAffine2 ReflectionAlongX(const sf::Vector2<F>& center = {}) {
+			return { static_cast<F>(1), static_cast<F>(0), static_cast<F>(0), static_cast<F>(0), static_cast<F>(-1), static_cast<F>(2) * center.y };
+		}
+
+		static BasicAffine2 ReflectionAlongY(const sf::Vector2<F>& center = {}) {
+			return { static_cast<F>(-1), static_cast<F>(0), static_cast<F>(2) * center.x, static_cast<F>(0), static_cast<F>(1), static_cast<F>(0) };
+		}
+
+		//////////////////////////////////////////////////////////////////////
+		//	COMPOSITION
+		//////////////////////////////////////////////////////////////////////
+
+		// NOTE:
+		// - the result applies this transform first and then other
+		constexpr BasicAffine2 Combine(const BasicAffine2& other) const {
+			return other * *this;
+		}
+
+		BasicAffine2& Translate(const sf::Vector2<F>& translation) { return *this = Combine(Translation(translation)); }
+		BasicAffine2& Rotate(const F sin, const F cos, const sf::Vector2<F>& center = {}) { return *this = Combine(Rotation(sin, cos, center)); }
+		BasicAffine2& Rotate(const F angle, const sf::Vector2<F>& center = {}) { return *this = Combine(Rotation(angle, center)); }
+		BasicAffine2& Scale(const sf::Vector2<F>& scaleFactor, const sf::Vector2<F>& center = {}) { return *this = Combine(Scaling(scaleFactor, center)); }
+		BasicAffine2& Shear(const sf::Vector2<F>& shearFactor, const sf::Vector2<F>& center = {}) { return *this = Combine(Shearing(shearFactor, center)); }
+		BasicAffine2& ReflectAlongX(const sf::Vector2<F>& center = {}) { return *this = Combine(ReflectionAlongX(center)); }
+		BasicAffine2& ReflectAlongY(const sf::Vector2<F>& center = {}) { return *this = Combine(ReflectionAlongY(center)); }
+
+		//////////////////////////////////////////////////////////////////////
+		//	GETTERS
+		//////////////////////////////////////////////////////////////////////
+
+		constexpr F GetDeterminant() const {
+			return a * d - b * c;
+		}
+
+		// NOTE:
+		// - a transform with a determinant of 0 has no inverse and gives back the identity
+		constexpr BasicAffine2 GetInverse() const {
+			const F det = GetDeterminant();
+			if (det == static_cast<F>(0)) { return {}; }
+			const F inv = static_cast<F>(1) / det;
+			return { d * inv, -b * inv, (b * ty - d * tx) * inv, -c * inv, a * inv, (c * tx - a * ty) * inv };
+		}
+
+		sf::Vector2<F> Apply(const sf::Vector2<F>& point) const {
+			return { a * point.x + b * point.y + tx, c * point.x + d * point.y + ty };
+		}
+
+		//////////////////////////////////////////////////////////////////////
+		//	OPERATORS
+		//////////////////////////////////////////////////////////////////////
+
+		// NOTE:
+		// - matrix product so (lhs * rhs) applies rhs first and then lhs
+		friend constexpr BasicAffine2 operator * (const BasicAffine2& lhs, const BasicAffine2& rhs) {
+			return {
+				lhs.a * rhs.a + lhs.b * rhs.c, lhs.a * rhs.b + lhs.b * rhs.d, lhs.a * rhs.tx + lhs.b * rhs.ty + lhs.tx,
+				lhs.c * rhs.a + lhs.d * rhs.c, lhs.c * rhs.b + lhs.d * rhs.d, lhs.c * rhs.tx + lhs.d * rhs.ty + lhs.ty
+			};
+		}
+
+		constexpr BasicAffine2& operator *= (const BasicAffine2& rhs) { return *this = *this * rhs; }
+
+		friend constexpr bool operator == (const BasicAffine2& lhs, const BasicAffine2& rhs) {
+			return lhs.a == rhs.a && lhs.b == rhs.b && lhs.tx == rhs.tx && lhs.c == rhs.c && lhs.d == rhs.d && lhs.ty == rhs.ty;
+		}
+
+		friend constexpr bool operator != (const BasicAffine2& lhs, const BasicAffine2& rhs) { return !(lhs == rhs); }
+
+		F a = static_cast<F>(1), b = static_cast<F>(0), tx = static_cast<F>(0);
+		F c = static_cast<F>(0), d = static_cast<F>(1), ty = static_cast<F>(0);
+
+	private:
+
+		// moves the center to the origin, applies the linear part and moves it back
+		static BasicAffine2 About(const BasicAffine2& linear, const sf::Vector2<F>& center) {
+			return { linear.a, linear.b, center.x - linear.a * center.x - linear.b * center.y, linear.c, linear.d, center.y - linear.c * center.x - linear.d * center.y };
+		}
+	};
+
+	using Affine2 = BasicAffine2<float>;
+
+	//////////////////////////////////////////////////////////////////////
+	//	FREE FUNCTIONS
+	//////////////////////////////////////////////////////////////////////
+
+	template <typename F>
+	void TransformPoint(sf::Vector2<F>& point, const BasicAffine2<F>& transform) {
+		point = transform.Apply(point);
+	}
+
+	// NOTE:
+	// - this interpolates each matrix entry on its own which is exact for
+	//   translation, scale and shear but shrinks in between rotations that are
+	//   far apart. rotate by a lerped angle instead when that matters
+	template <typename F, typename T>
+	constexpr BasicAffine2<F> Lerp(const BasicAffine2<F>& start, const BasicAffine2<F>& end, const T t) {
+		return { Lerp(start.a, end.a, t), Lerp(start.b, end.b, t), Lerp(start.tx, end.tx, t), Lerp(start.c, end.c, t), Lerp(start.d, end.d, t), Lerp(start.ty, end.ty, t) };
+	}
+
+}
@@ -24,9 +24,34 @@
 //																											  //
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "Affine.hpp"
+#include "Bezier.hpp"
+#include "CachedLayer.hpp"
+#include "Collision.hpp"
+#include "ColorUtils.hpp"
+#include "Emitter.hpp"
+#include "JobSystem.hpp"
 #include "Mathematics.hpp"
+#include "Noise.hpp"
+#include "PackedVertex.hpp"
+#include "Polyline.hpp"
+#include "Preloader.hpp"
+#include "ProfilerOverlay.hpp"
+#include "Profiling.hpp"
+#include "QuadPool.hpp"
 #include "QuadUtils.hpp"
 #include "Random.hpp"
 #include "ResourceManager.hpp"
+#include "Sampling.hpp"
+#include "Shapes.hpp"
+#include "Snapshot.hpp"
+#include "Sorting.hpp"
+#include "SpriteBatch.hpp"
+#include "TextBatch.hpp"
 #include "TextureAtlas.hpp"
+#include "TileMap.hpp"
+#include "Tween.hpp"
 #include "VertexArrayUtils.hpp"
+#include "VertexSpan.hpp"
+#include "VertexTraits.hpp"
+#include "VertexTripleBuffer.hpp"
@@ -0,0 +1,250 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			EVALUATION
+	------------------------------------------------------------
+	-	GetCubicBezierSegmentCount()
+	-	EvaluateCubicBezier()
+	-	ForEachCubicBezierPoint()
+
+	------------------------------------------------------------
+			MAKERS
+	------------------------------------------------------------
+	-	MakeCubicBezierLine()
+	-	MakeCubicBezierStrip()
+
+	------------------------------------------------------------
+			ARC LENGTH TABLE MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Create()
+	-	GetLength()
+	-	GetParameter()
+	-	GetPoint()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		const sf::Vector2f a = { 100.0f, 500.0f }, b = { 200.0f, 100.0f }, c = { 600.0f, 100.0f }, d = { 700.0f, 500.0f };
+
+		// pick just enough segments to stay within a quarter of a pixel of the curve
+		const std::size_t segments = Arc::GetCubicBezierSegmentCount(a, b, c, d, 0.25f);
+
+		// one quad per segment as a 4 pixel thick line
+		sf::VertexArray line(sf::Quads, 4 * segments);
+		Arc::MakeCubicBezierLine(line, 0, a, b, c, d, 4.0f, segments);
+
+		// or the same line as a triangle strip
+		sf::VertexArray strip(sf::TriangleStrip, 2 * (segments + 1));
+		Arc::MakeCubicBezierStrip(strip, 0, a, b, c, d, 4.0f, segments);
+
+		// move along the curve at a constant speed of 100 pixels per second
+		Arc::ArcLengthTable table;
+		table.Create(a, b, c, d);
+		const sf::Vector2f position = table.GetPoint(std::fmod(100.0f * time, table.GetLength()));
+
+	}
+
+*/
+
+#include "Mathematics.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	EVALUATION
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - uses wang's formula which gives the number of evenly spaced segments needed
+	//   to keep the flattened curve within tolerance of the real one. with tolerance
+	//   in pixels this is the screen space error
+	inline std::size_t GetCubicBezierSegmentCount(const sf::Vector2f& start, const sf::Vector2f& ctrl1, const sf::Vector2f& ctrl2, const sf::Vector2f& end, const float tolerance = 0.25f, const std::size_t maxSegments = 256) {
+		const sf::Vector2f d0 = start - 2.0f * ctrl1 + ctrl2;
+		const sf::Vector2f d1 = ctrl1 - 2.0f * ctrl2 + end;
+		const float m = std::sqrt(std::max(GetDotProduct(d0, d0), GetDotProduct(d1, d1)));
+		const float n = std::ceil(std::sqrt(0.75f * m / std::max(tolerance, 1e-4f)));
+		return std::clamp(static_cast<std::size_t>(n), std::size_t{ 1 }, std::max(std::size_t{ 1 }, maxSegments));
+	}
+
+	// NOTE:
+	// - writes count points evenly spaced in t from start to end (inclusive)
+	// - uses forward differencing so each point costs three vector additions
+	//   instead of the six lerps of Arc::CubicBezierSpline()
+	inline void EvaluateCubicBezier(const sf::Vector2f& start, const sf::Vector2f& ctrl1, const sf::Vector2f& ctrl2, const sf::Vector2f& end, sf::Vector2f* points, const std::size_t count) {
+		if (count == 0) { return; }
+		if (count == 1) { points[0] = start; return; }
+		const float h = 1.0f / static_cast<float>(count - 1);
+		const sf::Vector2f a = -start + 3.0f * ctrl1 - 3.0f * ctrl2 + end;
+		const sf::Vector2f b = 3.0f * start - 6.0f * ctrl1 + 3.0f * ctrl2;
+		const sf::Vector2f c = -3.0f * start + 3.0f * ctrl1;
+		sf::Vector2f p = start;
+		sf::Vector2f d1 = (h * h * h) * a + (h * h) * b + h * c;
+		sf::Vector2f d2 = (6.0f * h * h * h) * a + (2.0f * h * h) * b;
+		const sf::Vector2f d3 = (6.0f * h * h * h) * a;
+		for (std::size_t i = 0; i + 1 < count; ++i) {
+			points[i] = p;
+			p += d1;
+			d1 += d2;
+			d2 += d3;
+		}
+		points[count - 1] = end;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	MAKERS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - calls func(i, point, normal) for the segments + 1 points of the curve
+	//   where normal is the unit normal of the curve at that point
+	// - the point and the tangent are both forward differenced so there are no
+	//   per point lerps or trig calls
+	template <class Func>
+	void ForEachCubicBezierPoint(const sf::Vector2f& start, const sf::Vector2f& ctrl1, const sf::Vector2f& ctrl2, const sf::Vector2f& end, const std::size_t segments, Func&& func) {
+		const std::size_t n = std::max(std::size_t{ 1 }, segments);
+		const float h = 1.0f / static_cast<float>(n);
+		const sf::Vector2f a = -start + 3.0f * ctrl1 - 3.0f * ctrl2 + end;
+		const sf::Vector2f b = 3.0f * start - 6.0f * ctrl1 + 3.0f * ctrl2;
+		const sf::Vector2f c = -3.0f * start + 3.0f * ctrl1;
+		sf::Vector2f p = start;
+		sf::Vector2f d1 = (h * h * h) * a + (h * h) * b + h * c;
+		sf::Vector2f d2 = (6.0f * h * h * h) * a + (2.0f * h * h) * b;
+		const sf::Vector2f d3 = (6.0f * h * h * h) * a;
+		// the tangent is the quadratic 3at^2 + 2bt + c
+		sf::Vector2f tangent = c;
+		sf::Vector2f dt1 = (3.0f * h * h) * a + (2.0f * h) * b;
+		const sf::Vector2f dt2 = (6.0f * h * h) * a;
+		sf::Vector2f normal = { 0.0f, 1.0f };
+		const sf::Vector2f chord = end - start;
+		if (GetDotProduct(chord, chord) > 0.0f) { normal = GetUnitVector(sf::Vector2f(-chord.y, chord.x)); }
+		for (std::size_t i = 0; i <= n; ++i) {
+			// a zero tangent happens where a control point sits on an end point
+			// so the last good normal is kept
+			const float len2 = GetDotProduct(tangent, tangent);
+			if (len2 > 1e-12f) { normal = (1.0f / std::sqrt(len2)) * sf::Vector2f(-tangent.y, tangent.x); }
+			func(i, i == n ? end : p, normal);
+			p += d1;
+			d1 += d2;
+			d2 += d3;
+			tangent += dt1;
+			dt1 += dt2;
+		}
+	}
+
+	// NOTE:
+	// - writes segments quads starting at quad id. neighbouring quads share
+	//   their corners so there are no gaps at the joints
+	template <class V>
+	void MakeCubicBezierLine(V& vertices, const std::size_t id, const sf::Vector2f& start, const sf::Vector2f& ctrl1, const sf::Vector2f& ctrl2, const sf::Vector2f& end, const float thickness, const std::size_t segments) {
+		const float halfThickness = 0.5f * thickness;
+		sf::Vector2f prevLeft, prevRight;
+		ForEachCubicBezierPoint(start, ctrl1, ctrl2, end, segments, [&](const std::size_t i, const sf::Vector2f& point, const sf::Vector2f& normal) {
+			const sf::Vector2f left = point + halfThickness * normal;
+			const sf::Vector2f right = point - halfThickness * normal;
+			if (i > 0) {
+				const std::size_t idx = (id + i - 1) * 4;
+				vertices[idx + 0].position = prevLeft;
+				vertices[idx + 1].position = left;
+				vertices[idx + 2].position = right;
+				vertices[idx + 3].position = prevRight;
+			}
+			prevLeft = left;
+			prevRight = right;
+		});
+	}
+
+	// NOTE:
+	// - writes 2 * (segments + 1) vertices starting at vertex start for
+	//   drawing with sf::TriangleStrip
+	template <class V>
+	void MakeCubicBezierStrip(V& vertices, const std::size_t start, const sf::Vector2f& startPoint, const sf::Vector2f& ctrl1, const sf::Vector2f& ctrl2, const sf::Vector2f& endPoint, const float thickness, const std::size_t segments) {
+		const float halfThickness = 0.5f * thickness;
+		ForEachCubicBezierPoint(startPoint, ctrl1, ctrl2, endPoint, segments, [&](const std::size_t i, const sf::Vector2f& point, const sf::Vector2f& normal) {
+			const std::size_t idx = start + 2 * i;
+			vertices[idx + 0].position = point + halfThickness * normal;
+			vertices[idx + 1].position = point - halfThickness * normal;
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	ARC LENGTH TABLE
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - samples the curve once and stores the running length at each sample so
+	//   a distance along the curve can be turned back into t with a binary search
+	class ArcLengthTable {
+	public:
+
+		ArcLengthTable() = default;
+
+		void Create(const sf::Vector2f& start, const sf::Vector2f& ctrl1, const sf::Vector2f& ctrl2, const sf::Vector2f& end, const std::size_t samples = 64) {
+			m_points = { start, ctrl1, ctrl2, end };
+			const std::size_t count = std::max(std::size_t{ 2 }, samples + 1);
+			m_samples.resize(count);
+			m_lengths.resize(count);
+			EvaluateCubicBezier(start, ctrl1, ctrl2, end, m_samples.data(), count);
+			m_lengths[0] = 0.0f;
+			for (std::size_t i = 1; i < count; ++i) {
+				m_lengths[i] = m_lengths[i - 1] + GetVectorLength(m_samples[i] - m_samples[i - 1]);
+			}
+		}
+
+		float GetLength() const {
+			return m_lengths.empty() ? 0.0f : m_lengths.back();
+		}
+
+		// NOTE:
+		// - distances outside of [0, GetLength()] are clamped
+		float GetParameter(const float distance) const {
+			if (m_lengths.size() < 2) { return 0.0f; }
+			const float d = std::clamp(distance, 0.0f, m_lengths.back());
+			const std::size_t i = std::min<std::size_t>(static_cast<std::size_t>(std::upper_bound(m_lengths.begin(), m_lengths.end(), d) - m_lengths.begin()), m_lengths.size() - 1);
+			const float segment = m_lengths[i] - m_lengths[i - 1];
+			const float local = segment > 0.0f ? (d - m_lengths[i - 1]) / segment : 0.0f;
+			return (static_cast<float>(i - 1) + local) / static_cast<float>(m_lengths.size() - 1);
+		}
+
+		sf::Vector2f GetPoint(const float distance) const {
+			return CubicBezierSpline(m_points[0], m_points[1], m_points[2], m_points[3], GetParameter(distance));
+		}
+
+	private:
+		std::vector<sf::Vector2f> m_points;
+		std::vector<sf::Vector2f> m_samples;
+		std::vector<float> m_lengths;
+	};
+
+}
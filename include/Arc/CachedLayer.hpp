@@ -0,0 +1,214 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Create()
+	-	Invalidate()
+	-	InvalidateAll()
+	-	Update()
+	-	Draw()
+	-	IsDirty()
+	-	GetArea()
+	-	GetTileCount()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		sf::VertexArray background(sf::Quads, 4 * 200 * 200);
+		Arc::MakeGrid(background, 0, { 200, 200 }, { 32.0f, 32.0f });
+
+		Arc::CachedLayer layer;
+		layer.Create({ 0.0f, 0.0f, 6400.0f, 6400.0f }); // split into 512x512 render textures
+
+		// a quad changed. invalidate where it was and where it is now
+		layer.Invalidate(background, 42 * 4, 4);
+		Arc::MoveQuad(background, 42, { 32.0f, 0.0f });
+		layer.Invalidate(background, 42 * 4, 4);
+
+		// every frame. only the invalidated parts of the layer are drawn again
+		layer.Update(background, 0, background.getVertexCount(), sf::Quads, &tileset);
+		layer.Draw(window); // one textured quad per tile
+
+	}
+
+*/
+
+#include "Profiling.hpp"
+#include "QuadUtils.hpp"
+#include "VertexSpan.hpp"
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace Arc {
+
+	// NOTE:
+	// - caches a layer that rarely changes in render textures. one world unit is one pixel
+	// - the area is split into tiles of at most tileSize pixels so large layers fit within
+	//   the maximum texture size. each tile is drawn as one textured quad
+	// - invalidated regions are snapped to whole pixels and only those pixels are cleared
+	//   and drawn again, using a view whose viewport covers just that part of the tile
+	// - only plain render textures, quads and alpha or no blending are used so it also runs
+	//   on software OpenGL implementations like Mesa llvmpipe
+	class CachedLayer {
+	public:
+
+		CachedLayer() = default;
+
+		bool Create(const sf::FloatRect& area, const unsigned int tileSize = 512) {
+			m_tiles.clear();
+			m_area = area;
+			const unsigned int size = std::max(1u, std::min(tileSize, sf::Texture::getMaximumSize()));
+			const unsigned int width = static_cast<unsigned int>(std::ceil(area.width));
+			const unsigned int height = static_cast<unsigned int>(std::ceil(area.height));
+			for (unsigned int y = 0; y < height; y += size) {
+				for (unsigned int x = 0; x < width; x += size) {
+					Tile tile;
+					const unsigned int w = std::min(size, width - x);
+					const unsigned int h = std::min(size, height - y);
+					tile.texture = std::make_unique<sf::RenderTexture>();
+					if (!tile.texture->create(w, h)) {
+						m_tiles.clear();
+						return false;
+					}
+					tile.texture->clear(sf::Color::Transparent);
+					tile.texture->display();
+					tile.bounds = { area.left + static_cast<float>(x), area.top + static_cast<float>(y), static_cast<float>(w), static_cast<float>(h) };
+					tile.dirty = { 0, 0, static_cast<int>(w), static_cast<int>(h) };
+					MakeRect(tile.quad, 0, tile.bounds);
+					SetQuadTextureRect(tile.quad, 0, { 0.0f, 0.0f, static_cast<float>(w), static_cast<float>(h) });
+					SetQuadColor(tile.quad, 0, sf::Color::White);
+					m_tiles.push_back(std::move(tile));
+				}
+			}
+			return true;
+		}
+
+		// marks a region in world coordinates to be drawn again by the next Update()
+		void Invalidate(const sf::FloatRect& region) {
+			for (Tile& tile : m_tiles) {
+				sf::FloatRect overlap;
+				if (!tile.bounds.intersects(region, overlap)) { continue; }
+				const int left = static_cast<int>(std::floor(overlap.left - tile.bounds.left));
+				const int top = static_cast<int>(std::floor(overlap.top - tile.bounds.top));
+				const int right = static_cast<int>(std::ceil(overlap.left + overlap.width - tile.bounds.left));
+				const int bottom = static_cast<int>(std::ceil(overlap.top + overlap.height - tile.bounds.top));
+				if (tile.dirty.width <= 0 || tile.dirty.height <= 0) {
+					tile.dirty = { left, top, right - left, bottom - top };
+					continue;
+				}
+				const int dirtyLeft = std::min(tile.dirty.left, left);
+				const int dirtyTop = std::min(tile.dirty.top, top);
+				const int dirtyRight = std::max(tile.dirty.left + tile.dirty.width, right);
+				const int dirtyBottom = std::max(tile.dirty.top + tile.dirty.height, bottom);
+				tile.dirty = { dirtyLeft, dirtyTop, dirtyRight - dirtyLeft, dirtyBottom - dirtyTop };
+			}
+		}
+
+		// NOTE:
+		// - invalidates the bounds of a vertex range. when vertices move call it both before and
+		//   after moving them so the pixels they leave behind are cleared too
+		template <class V>
+		void Invalidate(const V& vertices, const std::size_t start, const std::size_t count) {
+			if (count == 0) { return; }
+			Invalidate(GetVertexArrayBounds(vertices, start, count));
+		}
+
+		void InvalidateAll() {
+			Invalidate(m_area);
+		}
+
+		// NOTE:
+		// - draws the vertices into every invalidated region. the vertices are not culled,
+		//   anything outside the region is clipped by the viewport
+		void Update(const sf::Vertex* vertices, const std::size_t count, const sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) {
+			ARC_PROFILE_SCOPE("CachedLayer::Update");
+			for (Tile& tile : m_tiles) {
+				if (tile.dirty.width <= 0 || tile.dirty.height <= 0) { continue; }
+				const sf::FloatRect dirty(tile.dirty);
+				const sf::FloatRect region(tile.bounds.left + dirty.left, tile.bounds.top + dirty.top, dirty.width, dirty.height);
+				sf::View view(region);
+				view.setViewport({ dirty.left / tile.bounds.width, dirty.top / tile.bounds.height, dirty.width / tile.bounds.width, dirty.height / tile.bounds.height });
+				tile.texture->setView(view);
+
+				// overwrite the region with transparent pixels instead of clearing the whole texture
+				std::array<sf::Vertex, 4> clear;
+				MakeRect(clear, 0, region);
+				SetQuadColor(clear, 0, sf::Color::Transparent);
+				tile.texture->draw(clear.data(), clear.size(), sf::Quads, sf::RenderStates(sf::BlendNone));
+
+				if (count > 0) { tile.texture->draw(vertices, count, type, states); }
+				tile.texture->display();
+				tile.dirty = {};
+			}
+		}
+
+		template <class V>
+		void Update(const V& vertices, const std::size_t start, const std::size_t count, const sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) {
+			const auto span = MakeVertexSpan(vertices, start, count);
+			Update(span.data(), span.size(), type, states);
+		}
+
+		void Draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) const {
+			for (const Tile& tile : m_tiles) {
+				states.texture = &tile.texture->getTexture();
+				target.draw(tile.quad.data(), tile.quad.size(), sf::Quads, states);
+			}
+		}
+
+		bool IsDirty() const {
+			return std::any_of(m_tiles.begin(), m_tiles.end(), [](const Tile& tile) { return tile.dirty.width > 0 && tile.dirty.height > 0; });
+		}
+
+		const sf::FloatRect& GetArea() const { return m_area; }
+
+		std::size_t GetTileCount() const { return m_tiles.size(); }
+
+	private:
+
+		struct Tile {
+			std::unique_ptr<sf::RenderTexture> texture;
+			std::array<sf::Vertex, 4> quad;
+			sf::FloatRect bounds; // in world coordinates
+			sf::IntRect dirty; // in pixels of this tile
+		};
+
+		std::vector<Tile> m_tiles;
+		sf::FloatRect m_area;
+	};
+
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			NARROW PHASE
+	------------------------------------------------------------
+	-	QuadPointsOverlap()
+	-	QuadsOverlap()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	SetThreadCount()
+	-	SetParallelThreshold()
+	-	FindPairs()
+	-	FilterPairs()
+	-	GetPairs()
+	-	GetCellSize()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::QuadBroadPhase broadPhase;
+
+		// every frame
+		broadPhase.FindPairs(bullets, 0, bulletCount); // pairs of quads whose bounding boxes overlap
+		broadPhase.FilterPairs(bullets); // optional. keeps only the pairs whose rotated quads overlap
+		for (const Arc::QuadPair& pair : broadPhase.GetPairs()) {
+			OnHit(pair.first, pair.second);
+		}
+
+	}
+
+*/
+
+#include "JobSystem.hpp"
+#include "Profiling.hpp"
+#include "QuadUtils.hpp"
+#include "Sorting.hpp"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	NARROW PHASE
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - separating axis test between two quads given as 4 corner points each
+	// - only the edges 0-1 and 1-2 of each quad are used as axes, which is exact for
+	//   rectangles and parallelograms (everything QuadUtils makes and transforms)
+	// - touching quads count as overlapping
+	inline bool QuadPointsOverlap(const sf::Vector2f* a, const sf::Vector2f* b) {
+		const sf::Vector2f axes[4] = { a[1] - a[0], a[2] - a[1], b[1] - b[0], b[2] - b[1] };
+		for (const sf::Vector2f& edge : axes) {
+			const sf::Vector2f axis(-edge.y, edge.x);
+			float minA = axis.x * a[0].x + axis.y * a[0].y;
+			float maxA = minA;
+			float minB = axis.x * b[0].x + axis.y * b[0].y;
+			float maxB = minB;
+			for (std::size_t i = 1; i < 4; ++i) {
+				const float pa = axis.x * a[i].x + axis.y * a[i].y;
+				const float pb = axis.x * b[i].x + axis.y * b[i].y;
+				minA = std::min(minA, pa);
+				maxA = std::max(maxA, pa);
+				minB = std::min(minB, pb);
+				maxB = std::max(maxB, pb);
+			}
+			if (maxA < minB || maxB < minA) { return false; }
+		}
+		return true;
+	}
+
+	template <class V1, class V2>
+	bool QuadsOverlap(const V1& vtx1, const std::size_t id1, const V2& vtx2, const std::size_t id2) {
+		using Traits1 = VertexTraitsOf<V1>;
+		using Traits2 = VertexTraitsOf<V2>;
+		sf::Vector2f a[4];
+		sf::Vector2f b[4];
+		for (std::size_t i = 0; i < 4; ++i) {
+			a[i] = Traits1::GetPosition(vtx1[id1 * 4 + i]);
+			b[i] = Traits2::GetPosition(vtx2[id2 * 4 + i]);
+		}
+		return QuadPointsOverlap(a, b);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	BROAD PHASE
+	//////////////////////////////////////////////////////////////////////
+
+	// quad ids are the same ids used with the QuadUtils functions and first < second
+	struct QuadPair {
+		std::uint32_t first = 0;
+		std::uint32_t second = 0;
+	};
+
+	// NOTE:
+	// - a uniform grid rebuilt from scratch every call in O(n). each quad's bounding box
+	//   is added to every cell it touches, the entries are radix sorted by cell and the
+	//   quads sharing a cell are tested against each other
+	// - a pair is only reported by the first cell both boxes share, so no pair is reported twice
+	// - the bounds and the per-cell tests run on several threads once there are at least
+	//   SetParallelThreshold() quads. the pairs end up in the same order either way
+	// - all buffers are kept between calls so a steady number of quads does not allocate
+	class QuadBroadPhase {
+	public:
+
+		QuadBroadPhase() = default;
+
+		// 0 uses every thread of GetJobSystem()
+		void SetThreadCount(const unsigned count) {
+			m_threadCount = count;
+		}
+
+		void SetParallelThreshold(const std::size_t count) {
+			m_parallelThreshold = count;
+		}
+
+		// NOTE:
+		// - a cell size of 0 picks twice the average quad size
+		// - quads larger than a few cells are added to many cells and make the grid slower
+		template <class V>
+		const std::vector<QuadPair>& FindPairs(const V& vertices, const std::size_t firstId, const std::size_t count, const float cellSize = 0.0f) {
+			ARC_PROFILE_SCOPE("QuadBroadPhase::FindPairs");
+			m_pairs.clear();
+			if (count == 0) { return m_pairs; }
+
+			const unsigned threads = GetWorkerCount(count);
+			m_bounds.resize(count);
+			Run(count, threads, [&](const std::size_t begin, const std::size_t end, unsigned) {
+				for (std::size_t i = begin; i < end; ++i) { m_bounds[i] = GetQuadBounds(vertices, firstId + i); }
+			});
+
+			sf::Vector2f minimum = { m_bounds[0].left, m_bounds[0].top };
+			sf::Vector2f maximum = minimum;
+			float extent = 0.0f;
+			for (const sf::FloatRect& bounds : m_bounds) {
+				minimum.x = std::min(minimum.x, bounds.left);
+				minimum.y = std::min(minimum.y, bounds.top);
+				maximum.x = std::max(maximum.x, bounds.left + bounds.width);
+				maximum.y = std::max(maximum.y, bounds.top + bounds.height);
+				extent += std::max(bounds.width, bounds.height);
+			}
+			m_origin = minimum;
+			m_cellSize = cellSize > 0.0f ? cellSize : 2.0f * extent / static_cast<float>(count);
+			// cells are stored in 16 bits per axis
+			m_cellSize = std::max({ m_cellSize, (maximum.x - minimum.x) / 65535.0f, (maximum.y - minimum.y) / 65535.0f, 1e-6f });
+			m_inverseCellSize = 1.0f / m_cellSize;
+
+			m_keys.clear();
+			m_entries.clear();
+			for (std::size_t i = 0; i < count; ++i) {
+				const sf::FloatRect& bounds = m_bounds[i];
+				const std::uint32_t x0 = GetCell(bounds.left - m_origin.x);
+				const std::uint32_t x1 = GetCell(bounds.left + bounds.width - m_origin.x);
+				const std::uint32_t y0 = GetCell(bounds.top - m_origin.y);
+				const std::uint32_t y1 = GetCell(bounds.top + bounds.height - m_origin.y);
+				for (std::uint32_t y = y0; y <= y1; ++y) {
+					for (std::uint32_t x = x0; x <= x1; ++x) {
+						m_keys.push_back((y << 16) | x);
+						m_entries.push_back(static_cast<std::uint32_t>(i));
+					}
+				}
+			}
+			RadixSortIndices(m_keys.data(), m_keys.size(), m_order, m_scratch);
+
+			m_cells.clear();
+			for (std::size_t i = 0; i < m_order.size(); ++i) {
+				if (i == 0 || m_keys[m_order[i]] != m_keys[m_order[i - 1]]) { m_cells.push_back(static_cast<std::uint32_t>(i)); }
+			}
+			m_cells.push_back(static_cast<std::uint32_t>(m_order.size()));
+
+			const std::uint32_t first = static_cast<std::uint32_t>(firstId);
+			m_threadPairs.resize(threads);
+			Run(m_cells.size() - 1, threads, [&](const std::size_t begin, const std::size_t end, const unsigned thread) {
+				std::vector<QuadPair>& pairs = m_threadPairs[thread];
+				pairs.clear();
+				for (std::size_t cell = begin; cell < end; ++cell) {
+					const std::uint32_t key = m_keys[m_order[m_cells[cell]]];
+					for (std::uint32_t i = m_cells[cell]; i < m_cells[cell + 1]; ++i) {
+						const std::uint32_t a = m_entries[m_order[i]];
+						const sf::FloatRect& boundsA = m_bounds[a];
+						for (std::uint32_t j = i + 1; j < m_cells[cell + 1]; ++j) {
+							const std::uint32_t b = m_entries[m_order[j]];
+							const sf::FloatRect& boundsB = m_bounds[b];
+							if (boundsA.left > boundsB.left + boundsB.width || boundsB.left > boundsA.left + boundsA.width) { continue; }
+							if (boundsA.top > boundsB.top + boundsB.height || boundsB.top > boundsA.top + boundsA.height) { continue; }
+							const std::uint32_t x = GetCell(std::max(boundsA.left, boundsB.left) - m_origin.x);
+							const std::uint32_t y = GetCell(std::max(boundsA.top, boundsB.top) - m_origin.y);
+							if (((y << 16) | x) != key) { continue; }
+							pairs.push_back({ first + a, first + b });
+						}
+					}
+				}
+			});
+			for (const std::vector<QuadPair>& pairs : m_threadPairs) {
+				m_pairs.insert(m_pairs.end(), pairs.begin(), pairs.end());
+			}
+			return m_pairs;
+		}
+
+		// NOTE:
+		// - the narrow phase. removes the pairs whose quads only overlap by their bounding
+		//   boxes using QuadsOverlap(). vertices must be the container passed to FindPairs()
+		template <class V>
+		const std::vector<QuadPair>& FilterPairs(const V& vertices) {
+			ARC_PROFILE_SCOPE("QuadBroadPhase::FilterPairs");
+			const unsigned threads = GetWorkerCount(m_pairs.size());
+			m_threadPairs.resize(threads);
+			Run(m_pairs.size(), threads, [&](const std::size_t begin, const std::size_t end, const unsigned thread) {
+				std::vector<QuadPair>& pairs = m_threadPairs[thread];
+				pairs.clear();
+				for (std::size_t i = begin; i < end; ++i) {
+					if (QuadsOverlap(vertices, m_pairs[i].first, vertices, m_pairs[i].second)) { pairs.push_back(m_pairs[i]); }
+				}
+			});
+			m_pairs.clear();
+			for (const std::vector<QuadPair>& pairs : m_threadPairs) {
+				m_pairs.insert(m_pairs.end(), pairs.begin(), pairs.end());
+			}
+			return m_pairs;
+		}
+
+		const std::vector<QuadPair>& GetPairs() const { return m_pairs; }
+
+		// the cell size used by the last FindPairs()
+		float GetCellSize() const { return m_cellSize; }
+
+	private:
+
+		std::uint32_t GetCell(const float offset) const {
+			return std::min(static_cast<std::uint32_t>(std::max(offset, 0.0f) * m_inverseCellSize), 65535u);
+		}
+
+		unsigned GetWorkerCount(const std::size_t count) const {
+			if (count < m_parallelThreshold) { return 1; }
+			const unsigned threads = m_threadCount == 0 ? GetJobSystem().GetThreadCount() : m_threadCount;
+			return std::max(threads, 1u);
+		}
+
+		// splits [0, count) into one contiguous range per thread on the job system. the third
+		// argument is the index of the range so each range can write to its own buffer. func is
+		// called for every index, with an empty range if count is small, so every buffer is reset
+		template <class F>
+		static void Run(const std::size_t count, const unsigned threads, F&& func) {
+			if (threads <= 1) {
+				func(std::size_t(0), count, 0u);
+				return;
+			}
+			const std::size_t chunk = (count + threads - 1) / threads;
+			GetJobSystem().ParallelFor(threads, 1, [&func, count, chunk](const std::size_t first, const std::size_t last) {
+				for (std::size_t thread = first; thread < last; ++thread) {
+					const std::size_t begin = std::min(count, thread * chunk);
+					func(begin, std::min(count, begin + chunk), static_cast<unsigned>(thread));
+				}
+			});
+		}
+
+		std::vector<sf::FloatRect> m_bounds;
+		std::vector<std::uint32_t> m_keys; // the cell of each entry
+		std::vector<std::uint32_t> m_entries; // the quad of each entry
+		std::vector<std::uint32_t> m_order; // entries sorted by cell
+		std::vector<std::uint32_t> m_scratch;
+		std::vector<std::uint32_t> m_cells; // where each cell starts in m_order
+		std::vector<std::vector<QuadPair>> m_threadPairs;
+		std::vector<QuadPair> m_pairs;
+		sf::Vector2f m_origin;
+		float m_cellSize = 0.0f;
+		float m_inverseCellSize = 0.0f;
+		unsigned m_threadCount = 0;
+		std::size_t m_parallelThreshold = 8192;
+	};
+
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CORE FUNCTIONS
+	------------------------------------------------------------
+	-	GetColorWeight()
+	-	MixChannel()
+	-	StepChannel()
+	-	MultiplyChannel()
+	-	MixColors()
+	-	MultiplyColors()
+
+	------------------------------------------------------------
+			SETTERS
+	------------------------------------------------------------
+	-	LerpVertexArrayColor()
+	-	MultiplyVertexArrayColor()
+	-	SetVertexArrayAlpha()
+	-	SetVertexArrayLinearGradient()
+	-	SetVertexArrayRadialGradient()
+	-	SetVertexArrayPalette()
+	-	FadeQuadsByLifetime()
+
+*/
+
+#include "Mathematics.hpp"
+#include "VertexTraits.hpp"
+#include <SFML/Graphics/Vertex.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	CORE FUNCTIONS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - all color math here is 8 bit fixed point. weights go from 0 (all start)
+	//   to 256 (all end) so a blend is one multiply add and a shift per channel
+	//   with no float conversions which lets the loops vectorize
+	inline std::uint32_t GetColorWeight(const float t) {
+		return static_cast<std::uint32_t>(std::clamp(t, 0.0f, 1.0f) * 256.0f + 0.5f);
+	}
+
+	inline sf::Uint8 MixChannel(const std::uint32_t a, const std::uint32_t b, const std::uint32_t weight) {
+		return static_cast<sf::Uint8>((a * (256u - weight) + b * weight) >> 8);
+	}
+
+	// NOTE:
+	// - moves a weight / 256 of the way towards b, rounded away from a so any nonzero
+	//   weight moves it by at least 1. repeated steps reach b instead of stalling short of it
+	inline sf::Uint8 StepChannel(const std::uint32_t a, const std::uint32_t b, const std::uint32_t weight) {
+		const std::uint32_t step = ((b > a ? b - a : a - b) * weight + 255u) >> 8;
+		return static_cast<sf::Uint8>(b > a ? a + step : a - step);
+	}
+
+	// NOTE:
+	// - exact round(a * b / 255) without a division
+	inline sf::Uint8 MultiplyChannel(const std::uint32_t a, const std::uint32_t b) {
+		const std::uint32_t t = a * b + 128u;
+		return static_cast<sf::Uint8>((t + (t >> 8)) >> 8);
+	}
+
+	inline sf::Color MixColors(const sf::Color& start, const sf::Color& end, const std::uint32_t weight) {
+		return { MixChannel(start.r, end.r, weight), MixChannel(start.g, end.g, weight), MixChannel(start.b, end.b, weight), MixChannel(start.a, end.a, weight) };
+	}
+
+	inline sf::Color MultiplyColors(const sf::Color& a, const sf::Color& b) {
+		return { MultiplyChannel(a.r, b.r), MultiplyChannel(a.g, b.g), MultiplyChannel(a.b, b.b), MultiplyChannel(a.a, b.a) };
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	SETTERS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - moves every color in the range t of the way towards target. calling this
+	//   every frame with a small t gives an exponential fade that ends on target
+	template <class V>
+	void LerpVertexArrayColor(V& vertices, const std::size_t start, const std::size_t count, const sf::Color& target, const float t) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		const std::uint32_t weight = GetColorWeight(t);
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			sf::Color& c = vertices[idx].color;
+			c.r = StepChannel(c.r, target.r, weight);
+			c.g = StepChannel(c.g, target.g, weight);
+			c.b = StepChannel(c.b, target.b, weight);
+			c.a = StepChannel(c.a, target.a, weight);
+			++idx;
+		}
+	}
+
+	// NOTE:
+	// - like sf::Color's operator * so white leaves the colors unchanged, but each
+	//   channel is rounded where SFML truncates
+	template <class V>
+	void MultiplyVertexArrayColor(V& vertices, const std::size_t start, const std::size_t count, const sf::Color& tint) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			sf::Color& c = vertices[idx].color;
+			c.r = MultiplyChannel(c.r, tint.r);
+			c.g = MultiplyChannel(c.g, tint.g);
+			c.b = MultiplyChannel(c.b, tint.b);
+			c.a = MultiplyChannel(c.a, tint.a);
+			++idx;
+		}
+	}
+
+	template <class V>
+	void SetVertexArrayAlpha(V& vertices, const std::size_t start, const std::size_t count, const sf::Uint8 alpha) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			vertices[idx].color.a = alpha;
+			++idx;
+		}
+	}
+
+	// NOTE:
+	// - each vertex is projected onto the line from -> to. vertices at or before from
+	//   get startColor and vertices at or after to get endColor
+	template <class V>
+	void SetVertexArrayLinearGradient(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& from, const sf::Vector2f& to, const sf::Color& startColor, const sf::Color& endColor) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		const sf::Vector2f axis = to - from;
+		const float lengthSquared = GetDotProduct(axis, axis);
+		const sf::Vector2f scaledAxis = lengthSquared > 0.0f ? (256.0f / lengthSquared) * axis : sf::Vector2f();
+		const float offset = -GetDotProduct(from, scaledAxis);
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			const sf::Vector2f& p = vertices[idx].position;
+			const float t = p.x * scaledAxis.x + p.y * scaledAxis.y + offset;
+			const std::uint32_t weight = static_cast<std::uint32_t>(std::clamp(t, 0.0f, 256.0f) + 0.5f);
+			vertices[idx].color = MixColors(startColor, endColor, weight);
+			++idx;
+		}
+	}
+
+	// NOTE:
+	// - innerColor at center fading to outerColor at radius and beyond
+	template <class V>
+	void SetVertexArrayRadialGradient(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& center, const float radius, const sf::Color& innerColor, const sf::Color& outerColor) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		const float scale = radius > 0.0f ? 256.0f / radius : 0.0f;
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			const sf::Vector2f d = vertices[idx].position - center;
+			const float t = std::sqrt(d.x * d.x + d.y * d.y) * scale;
+			const std::uint32_t weight = radius > 0.0f ? static_cast<std::uint32_t>(std::min(t, 256.0f) + 0.5f) : 256u;
+			vertices[idx].color = MixColors(innerColor, outerColor, weight);
+			++idx;
+		}
+	}
+
+	// NOTE:
+	// - vertex start + i gets palette[indices[i]]
+	// - I can be any unsigned integer type. the palette must be large enough for every index
+	template <class V, typename I>
+	void SetVertexArrayPalette(V& vertices, const std::size_t start, const std::size_t count, const I* indices, const sf::Color* palette) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		static_assert(std::is_integral_v<I> && std::is_unsigned_v<I>, "palette indices must be unsigned integers");
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			vertices[idx].color = palette[indices[i]];
+			++idx;
+		}
+	}
+
+	// NOTE:
+	// - quad firstId + i gets an alpha of maxAlpha * lifetimes[i] / fadeTime so quads
+	//   fade out over the last fadeTime of their life and are fully transparent at 0
+	template <class V>
+	void FadeQuadsByLifetime(V& vertices, const std::size_t firstId, const std::size_t count, const float* lifetimes, const float fadeTime, const sf::Uint8 maxAlpha = 255) {
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		const float scale = fadeTime > 0.0f ? static_cast<float>(maxAlpha) / fadeTime : 0.0f;
+		std::size_t idx = firstId * 4;
+		for (std::size_t i = 0; i < count; ++i) {
+			const float a = fadeTime > 0.0f ? std::clamp(lifetimes[i] * scale, 0.0f, static_cast<float>(maxAlpha)) : (lifetimes[i] > 0.0f ? static_cast<float>(maxAlpha) : 0.0f);
+			const sf::Uint8 alpha = static_cast<sf::Uint8>(a + 0.5f);
+			vertices[idx + 0].color.a = alpha;
+			vertices[idx + 1].color.a = alpha;
+			vertices[idx + 2].color.a = alpha;
+			vertices[idx + 3].color.a = alpha;
+			idx += 4;
+		}
+	}
+
+}
@@ -0,0 +1,381 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			AFFECTORS
+	------------------------------------------------------------
+	-	Gravity
+	-	Drag
+	-	Spin
+	-	ColorOverLife
+	-	SizeOverLife
+	-	Attractor
+	-	Turbulence
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Emit()
+	-	Update()
+	-	WriteQuads()
+	-	GetAffector()
+	-	GetParticles()
+	-	GetCount()
+	-	Reserve()
+	-	Clear()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		// the affectors run in the order they are listed, fused into one loop per update
+		Arc::Emitter<Arc::Gravity, Arc::Drag, Arc::ColorOverLife, Arc::Spin> emitter(
+			Arc::Gravity{ { 0.0f, 400.0f } },
+			Arc::Drag{ 0.5f },
+			Arc::ColorOverLife{ sf::Color::Yellow, sf::Color::Transparent },
+			Arc::Spin{}
+		);
+
+		Arc::ParticleSpawn spawn;
+		spawn.position = { 400.0f, 300.0f };
+		spawn.velocity = { 0.0f, -300.0f };
+		spawn.lifetime = 2.0f;
+		emitter.Emit(spawn);
+
+		// affectors can be changed between updates
+		emitter.GetAffector<Arc::Gravity>().acceleration = { 0.0f, 200.0f };
+
+		sf::VertexArray vertices(sf::Quads);
+		sf::Clock cl;
+		while (emitter.GetCount() > 0) {
+			emitter.Update(cl.restart().asSeconds()); // dead particles are removed here
+			vertices.resize(4 * emitter.GetCount());
+			emitter.WriteQuads(vertices, 0);
+		}
+
+	}
+
+*/
+
+#include "ColorUtils.hpp"
+#include "Mathematics.hpp"
+#include "Noise.hpp"
+#include "Profiling.hpp"
+#include "VertexTraits.hpp"
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	PARTICLE DATA
+	//////////////////////////////////////////////////////////////////////
+
+	struct ParticleSpawn {
+		sf::Vector2f position;
+		sf::Vector2f velocity;
+		sf::Vector2f size = { 8.0f, 8.0f };
+		float rotation = 0.0f; // degrees
+		float spin = 0.0f; // degrees per second
+		float lifetime = 1.0f; // seconds
+		sf::Color color = sf::Color::White;
+	};
+
+	// NOTE:
+	// - the particles stored as a structure of arrays. every array has one entry per particle
+	struct ParticleArrays {
+		std::vector<sf::Vector2f> positions;
+		std::vector<sf::Vector2f> velocities;
+		std::vector<sf::Vector2f> sizes;
+		std::vector<float> rotations;
+		std::vector<float> spins;
+		std::vector<float> ages;
+		std::vector<float> lifetimes;
+		std::vector<sf::Color> colors;
+	};
+
+	// NOTE:
+	// - raw pointers into ParticleArrays that the affectors index into. the update loop keeps
+	//   a local copy so the pointers stay in registers even when colors (bytes) are written
+	struct ParticleSpan {
+		sf::Vector2f* positions = nullptr;
+		sf::Vector2f* velocities = nullptr;
+		sf::Vector2f* sizes = nullptr;
+		float* rotations = nullptr;
+		float* spins = nullptr;
+		float* ages = nullptr;
+		float* lifetimes = nullptr;
+		sf::Color* colors = nullptr;
+		std::size_t count = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//	AFFECTORS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - an affector is any copyable type with a const call operator of the form
+	//   void operator()(const ParticleSpan& particles, std::size_t i, float dt, float life) const
+	//   where life is the age of particle i divided by its lifetime (0 to 1, and 1 when the
+	//   lifetime is 0 or less). lambdas work too
+	// - affectors change velocities, sizes, rotations or colors. the emitter moves the particles
+	//   by their velocity after every affector has run
+
+	struct Gravity {
+		sf::Vector2f acceleration = { 0.0f, 980.0f };
+
+		void operator()(const ParticleSpan& particles, const std::size_t i, const float dt, float) const {
+			particles.velocities[i] += dt * acceleration;
+		}
+	};
+
+	// velocities lose coefficient times themselves per second
+	struct Drag {
+		float coefficient = 1.0f;
+
+		void operator()(const ParticleSpan& particles, const std::size_t i, const float dt, float) const {
+			const float keep = 1.0f - coefficient * dt;
+			particles.velocities[i] *= keep > 0.0f ? keep : 0.0f;
+		}
+	};
+
+	// turns every particle by its spin
+	struct Spin {
+		void operator()(const ParticleSpan& particles, const std::size_t i, const float dt, float) const {
+			particles.rotations[i] += dt * particles.spins[i];
+		}
+	};
+
+	// blends in 8 bit fixed point like the ColorUtils kernels
+	struct ColorOverLife {
+		sf::Color start = sf::Color::White;
+		sf::Color end = sf::Color::Transparent;
+
+		void operator()(const ParticleSpan& particles, const std::size_t i, float, const float life) const {
+			const std::uint32_t weight = GetColorWeight(life);
+			sf::Color& c = particles.colors[i];
+			c.r = MixChannel(start.r, end.r, weight);
+			c.g = MixChannel(start.g, end.g, weight);
+			c.b = MixChannel(start.b, end.b, weight);
+			c.a = MixChannel(start.a, end.a, weight);
+		}
+	};
+
+	struct SizeOverLife {
+		sf::Vector2f start = { 8.0f, 8.0f };
+		sf::Vector2f end = { 0.0f, 0.0f };
+
+		void operator()(const ParticleSpan& particles, const std::size_t i, float, const float life) const {
+			particles.sizes[i] = Lerp(start, end, life);
+		}
+	};
+
+	// NOTE:
+	// - pulls particles towards point with strength / distance. a negative strength pushes them away
+	// - radius keeps particles close to the point from being flung out
+	struct Attractor {
+		sf::Vector2f point;
+		float strength = 1000.0f;
+		float radius = 1.0f;
+
+		void operator()(const ParticleSpan& particles, const std::size_t i, const float dt, float) const {
+			const sf::Vector2f offset = point - particles.positions[i];
+			const float distanceSq = offset.x * offset.x + offset.y * offset.y + radius * radius;
+			particles.velocities[i] += (dt * strength / distanceSq) * offset;
+		}
+	};
+
+	// NOTE:
+	// - accelerates particles along a simplex noise field sampled at their position. the field
+	//   does not change over time unless z is animated
+	struct Turbulence {
+		Noise noise;
+		float frequency = 0.01f;
+		float strength = 200.0f;
+		float z = 0.0f;
+
+		void operator()(const ParticleSpan& particles, const std::size_t i, const float dt, float) const {
+			const sf::Vector2f p = frequency * particles.positions[i];
+			const sf::Vector2f force = { noise.Simplex(p.x, p.y, z), noise.Simplex(p.x + 31.7f, p.y - 17.3f, z) };
+			particles.velocities[i] += (dt * strength) * force;
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//	EMITTER
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - the affectors are fixed at compile time and fused into one loop over the particles so
+	//   each particle is loaded once per update and there are no virtual calls or per affector
+	//   passes. they run in the order of the template arguments
+	// - dead particles are removed with a swap so the order of the particles is not kept
+	template <class... Affectors>
+	class Emitter {
+	public:
+
+		Emitter() = default;
+
+		template <std::size_t N = sizeof...(Affectors), std::enable_if_t<(N > 0), int> = 0>
+		explicit Emitter(Affectors... affectors) : m_affectors(std::move(affectors)...) {}
+
+		void Emit(const ParticleSpawn& spawn) {
+			m_particles.positions.push_back(spawn.position);
+			m_particles.velocities.push_back(spawn.velocity);
+			m_particles.sizes.push_back(spawn.size);
+			m_particles.rotations.push_back(spawn.rotation);
+			m_particles.spins.push_back(spawn.spin);
+			m_particles.ages.push_back(0.0f);
+			m_particles.lifetimes.push_back(spawn.lifetime);
+			m_particles.colors.push_back(spawn.color);
+		}
+
+		// NOTE:
+		// - ages every particle by dt, runs the affectors and moves the particles by their new
+		//   velocity. particles that reached their lifetime are removed afterwards
+		void Update(const float dt) {
+			ARC_PROFILE_SCOPE("Emitter::Update");
+			const ParticleSpan particles = GetSpan();
+			std::size_t dead = 0;
+			for (std::size_t i = 0; i < particles.count; ++i) {
+				const float age = particles.ages[i] + dt;
+				particles.ages[i] = age;
+				const float lifetime = particles.lifetimes[i];
+				dead += age >= lifetime;
+				const float life = lifetime > 0.0f ? std::min(age / lifetime, 1.0f) : 1.0f;
+				std::apply([&](const Affectors&... affectors) { (affectors(particles, i, dt, life), ...); }, m_affectors);
+				particles.positions[i] += dt * particles.velocities[i];
+			}
+			if (dead > 0) { RemoveDead(); }
+		}
+
+		// NOTE:
+		// - writes one quad per particle starting at quad firstId, centered on the particle's
+		//   position and rotated by its rotation. vertices needs room for 4 * GetCount() vertices
+		//   from there. texture coordinates are left alone
+		template <class V>
+		void WriteQuads(V& vertices, const std::size_t firstId) const {
+			static_assert(HasColorV<V>, "particles write an sf::Color to every vertex so palette index vertices are not supported");
+			using Traits = VertexTraitsOf<V>;
+			const ParticleArrays& p = m_particles;
+			std::size_t idx = 4 * firstId;
+			for (std::size_t i = 0; i < p.positions.size(); ++i) {
+				const float theta = Radians(p.rotations[i]);
+				const float sin = std::sin(theta), cos = std::cos(theta);
+				const sf::Vector2f half = 0.5f * p.sizes[i];
+				const sf::Vector2f x = { half.x * cos, half.x * sin };
+				const sf::Vector2f y = { -half.y * sin, half.y * cos };
+				const sf::Vector2f c = p.positions[i];
+				Traits::SetPosition(vertices[idx + 0], c - x - y);
+				Traits::SetPosition(vertices[idx + 1], c + x - y);
+				Traits::SetPosition(vertices[idx + 2], c + x + y);
+				Traits::SetPosition(vertices[idx + 3], c - x + y);
+				for (std::size_t j = 0; j < 4; ++j) { Traits::SetColor(vertices[idx + j], p.colors[i]); }
+				idx += 4;
+			}
+		}
+
+		template <class A>
+		A& GetAffector() { return std::get<A>(m_affectors); }
+
+		template <class A>
+		const A& GetAffector() const { return std::get<A>(m_affectors); }
+
+		const ParticleArrays& GetParticles() const { return m_particles; }
+
+		std::size_t GetCount() const { return m_particles.positions.size(); }
+
+		void Reserve(const std::size_t count) {
+			m_particles.positions.reserve(count);
+			m_particles.velocities.reserve(count);
+			m_particles.sizes.reserve(count);
+			m_particles.rotations.reserve(count);
+			m_particles.spins.reserve(count);
+			m_particles.ages.reserve(count);
+			m_particles.lifetimes.reserve(count);
+			m_particles.colors.reserve(count);
+		}
+
+		void Clear() {
+			Resize(0);
+		}
+
+	private:
+
+		ParticleSpan GetSpan() {
+			ParticleArrays& p = m_particles;
+			return { p.positions.data(), p.velocities.data(), p.sizes.data(), p.rotations.data(), p.spins.data(), p.ages.data(), p.lifetimes.data(), p.colors.data(), p.positions.size() };
+		}
+
+		void RemoveDead() {
+			const ParticleSpan p = GetSpan();
+			std::size_t count = p.count;
+			for (std::size_t i = 0; i < count;) {
+				if (p.ages[i] < p.lifetimes[i]) {
+					++i;
+					continue;
+				}
+				--count;
+				p.positions[i] = p.positions[count];
+				p.velocities[i] = p.velocities[count];
+				p.sizes[i] = p.sizes[count];
+				p.rotations[i] = p.rotations[count];
+				p.spins[i] = p.spins[count];
+				p.ages[i] = p.ages[count];
+				p.lifetimes[i] = p.lifetimes[count];
+				p.colors[i] = p.colors[count];
+			}
+			Resize(count);
+		}
+
+		void Resize(const std::size_t count) {
+			m_particles.positions.resize(count);
+			m_particles.velocities.resize(count);
+			m_particles.sizes.resize(count);
+			m_particles.rotations.resize(count);
+			m_particles.spins.resize(count);
+			m_particles.ages.resize(count);
+			m_particles.lifetimes.resize(count);
+			m_particles.colors.resize(count);
+		}
+
+		ParticleArrays m_particles;
+		std::tuple<Affectors...> m_affectors;
+	};
+
+}
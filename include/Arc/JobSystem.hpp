@@ -0,0 +1,354 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			FUNCTIONS
+	------------------------------------------------------------
+	-	GetJobSystem()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Schedule()
+	-	ScheduleOnMainThread()
+	-	Wait()
+	-	RunMainThreadJobs()
+	-	ParallelFor()
+	-	GetThreadCount()
+	-	IsMainThread()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::JobSystem& jobs = Arc::GetJobSystem(); // shared by every parallel part of Arc
+
+		// split a range over every core, 4096 vertices at a time
+		jobs.ParallelFor(vertices.size(), 4096, [&](std::size_t begin, std::size_t end) {
+			Arc::RotateVertexArray(vertices, begin, end - begin, 1.0f, { 400.0f, 300.0f });
+		});
+
+		// a small frame graph. the upload waits for the decode and only runs on the main thread
+		Arc::JobHandle decode = jobs.Schedule([&]() { image.loadFromFile("map.png"); });
+		Arc::JobHandle upload = jobs.ScheduleOnMainThread([&]() { texture.loadFromImage(image); }, { decode });
+		jobs.Wait(upload); // the main thread runs jobs while it waits, including its own
+
+	}
+
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Arc {
+
+	// NOTE:
+	// - every worker owns a deque. jobs scheduled from a worker go to the back of its own deque
+	//   and it takes them from the back again, which keeps forked work hot in its cache. idle
+	//   workers steal from the front of the other deques
+	// - jobs scheduled from other threads go to a shared queue that is taken in order
+	// - a job only runs once all its dependencies have finished. jobs scheduled on the main
+	//   thread (the thread that created the system) only run in RunMainThreadJobs() or in
+	//   Wait() called from the main thread, so they can touch OpenGL resources like sf::Texture
+	// - threads that Wait() run other jobs until the job they wait for is done
+	// - jobs must not throw
+	class JobSystem {
+	private:
+
+		struct Job {
+			std::function<void()> task;
+			std::atomic<int> dependencies{ 1 }; // the extra 1 keeps the job from starting while it is being scheduled
+			std::atomic<bool> done{ false };
+			std::mutex mutex;
+			std::vector<std::shared_ptr<Job>> dependents;
+			bool finished = false; // guarded by mutex. dependents added after this are not waited for
+			bool mainThread = false;
+		};
+
+	public:
+
+		class Handle {
+		public:
+			Handle() = default;
+			bool IsValid() const { return m_job != nullptr; }
+			bool IsDone() const { return m_job == nullptr || m_job->done.load(); }
+		private:
+			friend class JobSystem;
+			explicit Handle(std::shared_ptr<Job> job) : m_job(std::move(job)) {}
+			std::shared_ptr<Job> m_job;
+		};
+
+		// threads counts the calling thread, so threads - 1 workers are started. 0 uses every core
+		explicit JobSystem(unsigned int threads = 0) : m_mainThread(std::this_thread::get_id()) {
+			if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+			for (unsigned int i = 1; i < threads; ++i) { m_queues.push_back(std::make_unique<Queue>()); }
+			for (std::size_t i = 0; i < m_queues.size(); ++i) {
+				m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+			}
+		}
+
+		~JobSystem() {
+			{
+				std::lock_guard<std::mutex> lock(m_sleepMutex);
+				m_stop = true;
+			}
+			m_wake.notify_all();
+			for (std::thread& worker : m_workers) { worker.join(); }
+		}
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		Handle Schedule(std::function<void()> task, const std::vector<Handle>& dependencies = {}) {
+			return Submit(std::move(task), dependencies, false);
+		}
+
+		Handle ScheduleOnMainThread(std::function<void()> task, const std::vector<Handle>& dependencies = {}) {
+			return Submit(std::move(task), dependencies, true);
+		}
+
+		void Wait(const Handle& handle) {
+			const bool main = IsMainThread();
+			while (!handle.IsDone()) {
+				std::shared_ptr<Job> job = main ? PopMainThread() : nullptr;
+				if (!job) { job = Pop(GetWorkerIndex()); }
+				if (job) {
+					Run(job);
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(m_sleepMutex);
+				++m_waiters;
+				m_wake.wait(lock, [&]() { return handle.IsDone() || m_queued.load() > 0 || (main && m_mainQueued.load() > 0); });
+				--m_waiters;
+			}
+		}
+
+		// runs the main thread jobs that are ready and returns how many ran. call it once a frame
+		std::size_t RunMainThreadJobs() {
+			std::size_t count = 0;
+			while (std::shared_ptr<Job> job = PopMainThread()) {
+				Run(job);
+				++count;
+			}
+			return count;
+		}
+
+		// NOTE:
+		// - calls func(begin, end) over [0, count) in chunks of grain and returns once all are done.
+		//   the calling thread takes chunks too. a grain of 0 makes about 4 chunks per thread
+		// - chunks are handed out through one atomic counter so uneven chunks balance out
+		template <class F>
+		void ParallelFor(const std::size_t count, std::size_t grain, F&& func) {
+			if (count == 0) { return; }
+			if (grain == 0) { grain = std::max<std::size_t>(1, count / (4 * GetThreadCount())); }
+			const std::size_t chunks = (count + grain - 1) / grain;
+			if (chunks == 1 || m_workers.empty()) {
+				func(std::size_t(0), count);
+				return;
+			}
+			std::atomic<std::size_t> next{ 0 };
+			auto work = [&]() {
+				for (std::size_t chunk = next.fetch_add(1); chunk < chunks; chunk = next.fetch_add(1)) {
+					const std::size_t begin = chunk * grain;
+					func(begin, std::min(count, begin + grain));
+				}
+			};
+			std::vector<Handle> helpers;
+			const std::size_t helperCount = std::min(chunks - 1, m_workers.size());
+			helpers.reserve(helperCount);
+			for (std::size_t i = 0; i < helperCount; ++i) { helpers.push_back(Schedule(work)); }
+			work();
+			for (const Handle& helper : helpers) { Wait(helper); }
+		}
+
+		// the workers and the main thread
+		unsigned int GetThreadCount() const { return static_cast<unsigned int>(m_workers.size() + 1); }
+
+		bool IsMainThread() const { return std::this_thread::get_id() == m_mainThread; }
+
+	private:
+
+		struct Queue {
+			std::mutex mutex;
+			std::deque<std::shared_ptr<Job>> jobs;
+		};
+
+		static constexpr std::size_t NoWorker = static_cast<std::size_t>(-1);
+
+		// which worker of which system the current thread is
+		inline static thread_local const JobSystem* t_system = nullptr;
+		inline static thread_local std::size_t t_worker = NoWorker;
+
+		std::size_t GetWorkerIndex() const {
+			return t_system == this ? t_worker : NoWorker;
+		}
+
+		Handle Submit(std::function<void()> task, const std::vector<Handle>& dependencies, const bool mainThread) {
+			std::shared_ptr<Job> job = std::make_shared<Job>();
+			job->task = std::move(task);
+			job->mainThread = mainThread;
+			for (const Handle& dependency : dependencies) {
+				if (!dependency.m_job) { continue; }
+				std::lock_guard<std::mutex> lock(dependency.m_job->mutex);
+				if (dependency.m_job->finished) { continue; }
+				dependency.m_job->dependents.push_back(job);
+				job->dependencies.fetch_add(1);
+			}
+			if (job->dependencies.fetch_sub(1) == 1) { Enqueue(job); }
+			return Handle(job);
+		}
+
+		void Enqueue(const std::shared_ptr<Job>& job) {
+			if (job->mainThread) {
+				{
+					std::lock_guard<std::mutex> lock(m_mainQueue.mutex);
+					m_mainQueue.jobs.push_back(job);
+				}
+				m_mainQueued.fetch_add(1);
+			}
+			else {
+				const std::size_t worker = GetWorkerIndex();
+				Queue& queue = worker == NoWorker ? m_sharedQueue : *m_queues[worker];
+				{
+					std::lock_guard<std::mutex> lock(queue.mutex);
+					queue.jobs.push_back(job);
+				}
+				m_queued.fetch_add(1);
+			}
+			// taking the lock orders this with a thread that is about to sleep so the wake up is not lost
+			{ std::lock_guard<std::mutex> lock(m_sleepMutex); }
+			if (job->mainThread || m_waiters > 0) { m_wake.notify_all(); }
+			else { m_wake.notify_one(); }
+		}
+
+		std::shared_ptr<Job> PopMainThread() {
+			std::lock_guard<std::mutex> lock(m_mainQueue.mutex);
+			if (m_mainQueue.jobs.empty()) { return nullptr; }
+			std::shared_ptr<Job> job = std::move(m_mainQueue.jobs.front());
+			m_mainQueue.jobs.pop_front();
+			m_mainQueued.fetch_sub(1);
+			return job;
+		}
+
+		// own deque from the back, then the shared queue, then the other deques from the front
+		std::shared_ptr<Job> Pop(const std::size_t worker) {
+			if (worker != NoWorker) {
+				if (std::shared_ptr<Job> job = Take(*m_queues[worker], false)) { return job; }
+			}
+			if (std::shared_ptr<Job> job = Take(m_sharedQueue, true)) { return job; }
+			const std::size_t start = worker == NoWorker ? 0 : worker + 1;
+			for (std::size_t i = 0; i < m_queues.size(); ++i) {
+				const std::size_t victim = (start + i) % m_queues.size();
+				if (victim == worker) { continue; }
+				if (std::shared_ptr<Job> job = Take(*m_queues[victim], true)) { return job; }
+			}
+			return nullptr;
+		}
+
+		std::shared_ptr<Job> Take(Queue& queue, const bool front) {
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.jobs.empty()) { return nullptr; }
+			std::shared_ptr<Job> job;
+			if (front) {
+				job = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+			}
+			else {
+				job = std::move(queue.jobs.back());
+				queue.jobs.pop_back();
+			}
+			m_queued.fetch_sub(1);
+			return job;
+		}
+
+		void Run(const std::shared_ptr<Job>& job) {
+			job->task();
+			job->task = nullptr;
+			std::vector<std::shared_ptr<Job>> dependents;
+			{
+				std::lock_guard<std::mutex> lock(job->mutex);
+				job->finished = true;
+				dependents.swap(job->dependents);
+			}
+			job->done.store(true); // sequentially consistent with m_waiters so a waiter going to sleep sees it
+			for (const std::shared_ptr<Job>& dependent : dependents) {
+				if (dependent->dependencies.fetch_sub(1) == 1) { Enqueue(dependent); }
+			}
+			if (m_waiters > 0) {
+				{ std::lock_guard<std::mutex> lock(m_sleepMutex); }
+				m_wake.notify_all();
+			}
+		}
+
+		void WorkerLoop(const std::size_t worker) {
+			t_system = this;
+			t_worker = worker;
+			while (true) {
+				if (std::shared_ptr<Job> job = Pop(worker)) {
+					Run(job);
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(m_sleepMutex);
+				m_wake.wait(lock, [this]() { return m_stop || m_queued.load() > 0; });
+				if (m_stop) { return; }
+			}
+		}
+
+		std::thread::id m_mainThread;
+		std::vector<std::unique_ptr<Queue>> m_queues; // one per worker
+		Queue m_sharedQueue;
+		Queue m_mainQueue;
+		std::vector<std::thread> m_workers;
+		std::atomic<int> m_queued{ 0 }; // jobs in m_sharedQueue and m_queues
+		std::atomic<int> m_mainQueued{ 0 };
+		std::atomic<int> m_waiters{ 0 };
+		std::mutex m_sleepMutex;
+		std::condition_variable m_wake;
+		bool m_stop = false;
+	};
+
+	using JobHandle = JobSystem::Handle;
+
+	// NOTE:
+	// - the job system used by Arc's parallel functions. it is created on first use and that
+	//   thread becomes its main thread, so call it from the main thread first
+	inline JobSystem& GetJobSystem() {
+		static JobSystem system;
+		return system;
+	}
+
+}
@@ -32,6 +32,7 @@
 		-	Pi()
 		-	Degrees()
 		-	Radians()
+		-	SinCos()
 
 	------------------------------------------------------------
 			POINT TRANSFORMS
@@ -65,12 +66,19 @@
 		-	GetDotProduct()
 		-	GetCrossProduct()
 
+	------------------------------------------------------------
+			TABLES
+	------------------------------------------------------------
+		-	RadialTable
+
 */
 
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <cmath>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace Arc {
 
@@ -81,15 +89,45 @@ namespace Arc {
 	template <typename T> inline constexpr T Pi_v = static_cast<T>(3.14159265358979323846264338327950288);
 
 	template <typename F>
-	F Degrees(const F radians) {
+	constexpr F Degrees(const F radians) {
 		return (static_cast<F>(180) / Pi_v<F>) * radians;
 	}
 
 	template <typename F>
-	F Radians(const F degrees) {
+	constexpr F Radians(const F degrees) {
 		return (Pi_v<F> / static_cast<F>(180)) * degrees;
 	}
 
+	// NOTE:
+	// - returns { sin, cos } and unlike std::sin and std::cos this can be used in
+	//   constant expressions. at runtime prefer the standard functions
+	// - the angle is reduced to within pi / 4 of a multiple of pi / 2 and the rest
+	//   is a taylor series which is accurate to the precision of F for any angle
+	//   a game is likely to use
+	template <typename F>
+	constexpr std::pair<F, F> SinCos(const F radians) {
+		static_assert(std::is_floating_point_v<F>, "SinCos requires a floating point type");
+		const F halfPi = Pi_v<F> / static_cast<F>(2);
+		const F scaled = radians / halfPi;
+		const long long quadrant = static_cast<long long>(scaled < static_cast<F>(0) ? scaled - static_cast<F>(0.5) : scaled + static_cast<F>(0.5));
+		const F x = radians - static_cast<F>(quadrant) * halfPi;
+		const F x2 = x * x;
+		F sin = x, cos = static_cast<F>(1);
+		F sinTerm = x, cosTerm = static_cast<F>(1);
+		for (int n = 1; n <= 8; ++n) {
+			sinTerm *= -x2 / static_cast<F>((2 * n) * (2 * n + 1));
+			cosTerm *= -x2 / static_cast<F>((2 * n - 1) * (2 * n));
+			sin += sinTerm;
+			cos += cosTerm;
+		}
+		switch (((quadrant % 4) + 4) % 4) {
+		case 1: return { cos, -sin };
+		case 2: return { -sin, -cos };
+		case 3: return { -cos, sin };
+		default: return { sin, cos };
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////
 	//	POINT TRANSFORMS
 	//////////////////////////////////////////////////////////////////////
@@ -129,7 +167,7 @@ namespace Arc {
 	//////////////////////////////////////////////////////////////////////
 
 	template <typename T, typename F>
-	T Lerp(const T start, const T end, const F t) {
+	constexpr T Lerp(const T start, const T end, const F t) {
 		static_assert(std::is_floating_point_v<F>, "t must be a floating point type");
 		if constexpr (std::is_same_v<T, F>) {
 			return start * (static_cast<F>(1) - t) + end * t;
@@ -216,4 +254,52 @@ namespace Arc {
 		return a.x * b.y - a.y * b.x;
 	}
 
+	//////////////////////////////////////////////////////////////////////
+	//	TABLES
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - N unit vectors evenly spaced around a circle starting at angle 0 which
+	//   are all computed at compile time when the table is constexpr
+	// - Rotate() turns one of them by a phase given as a unit vector with a single
+	//   complex multiply so a whole ring of directions at any starting angle costs
+	//   one sin/cos for the phase and none per direction
+	template <std::size_t N, typename F = float>
+	class RadialTable {
+	public:
+
+		static_assert(N > 0, "a radial table needs at least one direction");
+
+		constexpr RadialTable() {
+			for (std::size_t i = 0; i < N; ++i) {
+				const std::pair<F, F> sc = SinCos(static_cast<F>(2) * Pi_v<F> * static_cast<F>(i) / static_cast<F>(N));
+				m_x[i] = sc.second;
+				m_y[i] = sc.first;
+			}
+		}
+
+		static constexpr std::size_t size() { return N; }
+
+		// NOTE:
+		// - angle of direction i in degrees
+		static constexpr F GetAngle(const std::size_t i) {
+			return static_cast<F>(360) * static_cast<F>(i) / static_cast<F>(N);
+		}
+
+		constexpr F GetX(const std::size_t i) const { return m_x[i]; }
+		constexpr F GetY(const std::size_t i) const { return m_y[i]; }
+
+		sf::Vector2<F> operator [] (const std::size_t i) const {
+			return { m_x[i], m_y[i] };
+		}
+
+		sf::Vector2<F> Rotate(const std::size_t i, const sf::Vector2<F>& phase) const {
+			return { m_x[i] * phase.x - m_y[i] * phase.y, m_x[i] * phase.y + m_y[i] * phase.x };
+		}
+
+	private:
+		F m_x[N] = {};
+		F m_y[N] = {};
+	};
+
 }
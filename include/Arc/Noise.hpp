@@ -0,0 +1,391 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Seed()
+	-	GetSeed()
+	-	Value()
+	-	Simplex()
+	-	Sample()
+	-	FillGrid()
+	-	Evaluate()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::RNG rng;
+		rng.Seed(42);
+
+		Arc::Noise noise;
+		noise.Seed(rng); // the same generator state always gives the same noise
+
+		// all noise functions return values between -1 and 1
+		float a = noise.Simplex(0.5f, 1.5f);
+		float b = noise.Value(0.5f, 1.5f, 2.5f);
+
+		// 4 octaves of fractal simplex noise over a 1024x1024 map, one sample per tile
+		Arc::NoiseSettings settings;
+		settings.frequency = 1.0f / 64.0f;
+		settings.octaves = 4;
+
+		std::vector<float> heights(1024 * 1024);
+		noise.FillGrid(heights.data(), { 1024, 1024 }, { 0.0f, 0.0f }, { 1.0f, 1.0f }, settings);
+
+	}
+
+*/
+
+#include "Random.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace Arc {
+
+	enum class NoiseType {
+		Value,
+		Simplex
+	};
+
+	// NOTE:
+	// - octaves greater than 1 sums that many layers of noise (fBm) where each layer
+	//   has its frequency multiplied by lacunarity and its amplitude multiplied by gain
+	// - the sum is normalized so the result still stays between -1 and 1
+	struct NoiseSettings {
+		NoiseType type = NoiseType::Simplex;
+		float frequency = 1.0f;
+		unsigned int octaves = 1;
+		float lacunarity = 2.0f;
+		float gain = 0.5f;
+	};
+
+	// NOTE:
+	// - lattice gradients and values come from an integer hash of the cell and
+	//   the seed instead of a permutation table. there are no table lookups and
+	//   no branches in the kernels so the bulk functions vectorize across points
+	//   when the compiler's auto vectorizer is on (-O3 or -O2 -ftree-vectorize)
+	class Noise {
+	public:
+
+		Noise() = default;
+
+		explicit Noise(const std::uint32_t seed) : m_seed(seed) {}
+
+		void Seed(const std::uint32_t seed) {
+			m_seed = seed;
+		}
+
+		template <class G>
+		void Seed(RandomGenerator<G>& rng) {
+			m_seed = rng.UniformDistribution(std::uint32_t{ 0 }, std::numeric_limits<std::uint32_t>::max());
+		}
+
+		std::uint32_t GetSeed() const {
+			return m_seed;
+		}
+
+		float Value(const float x, const float y) const {
+			float sum = 0.0f;
+			Value2D(&x, &y, 1, 1.0f, 1.0f, m_seed, &sum);
+			return sum;
+		}
+
+		float Value(const float x, const float y, const float z) const {
+			float sum = 0.0f;
+			Value3D(&x, &y, z, 1, 1.0f, 1.0f, m_seed, &sum);
+			return sum;
+		}
+
+		float Simplex(const float x, const float y) const {
+			float sum = 0.0f;
+			Simplex2D(&x, &y, 1, 1.0f, 1.0f, m_seed, &sum);
+			return sum;
+		}
+
+		float Simplex(const float x, const float y, const float z) const {
+			float sum = 0.0f;
+			Simplex3D(&x, &y, z, 1, 1.0f, 1.0f, m_seed, &sum);
+			return sum;
+		}
+
+		float Sample(const float x, const float y, const NoiseSettings& settings = {}) const {
+			float value = 0.0f;
+			EvaluateBlock(&x, &y, 0.0f, 1, &value, settings, false);
+			return value;
+		}
+
+		float Sample(const float x, const float y, const float z, const NoiseSettings& settings = {}) const {
+			float value = 0.0f;
+			EvaluateBlock(&x, &y, z, 1, &value, settings, true);
+			return value;
+		}
+
+		// NOTE:
+		// - writes size.x * size.y values in row major order where the value at (x, y)
+		//   is sampled at origin + (x * step.x, y * step.y)
+		void FillGrid(float* values, const sf::Vector2u& size, const sf::Vector2f& origin, const sf::Vector2f& step, const NoiseSettings& settings = {}) const {
+			FillGrid(values, size, origin, step, 0.0f, settings, false);
+		}
+
+		// NOTE:
+		// - samples a slice of 3D noise at depth z. animating z gives noise that
+		//   changes smoothly over time
+		void FillGrid(float* values, const sf::Vector2u& size, const sf::Vector2f& origin, const sf::Vector2f& step, const float z, const NoiseSettings& settings = {}) const {
+			FillGrid(values, size, origin, step, z, settings, true);
+		}
+
+		void Evaluate(const sf::Vector2f* points, const std::size_t count, float* values, const NoiseSettings& settings = {}) const {
+			Evaluate(points, count, 0.0f, values, settings, false);
+		}
+
+		void Evaluate(const sf::Vector2f* points, const std::size_t count, const float z, float* values, const NoiseSettings& settings = {}) const {
+			Evaluate(points, count, z, values, settings, true);
+		}
+
+	private:
+
+		static constexpr std::size_t BlockSize = 64;
+
+		std::uint32_t OctaveSeed(const unsigned int octave) const {
+			return m_seed + octave * 0x9E3779B9u;
+		}
+
+		void FillGrid(float* values, const sf::Vector2u& size, const sf::Vector2f& origin, const sf::Vector2f& step, const float z, const NoiseSettings& settings, const bool is3D) const {
+			float xs[BlockSize];
+			float ys[BlockSize];
+			for (unsigned int y = 0; y < size.y; ++y) {
+				const float py = origin.y + static_cast<float>(y) * step.y;
+				for (unsigned int x = 0; x < size.x; x += static_cast<unsigned int>(BlockSize)) {
+					const std::size_t n = std::min<std::size_t>(BlockSize, size.x - x);
+					for (std::size_t i = 0; i < n; ++i) {
+						xs[i] = origin.x + static_cast<float>(x + i) * step.x;
+						ys[i] = py;
+					}
+					EvaluateBlock(xs, ys, z, n, values + static_cast<std::size_t>(y) * size.x + x, settings, is3D);
+				}
+			}
+		}
+
+		void Evaluate(const sf::Vector2f* points, const std::size_t count, const float z, float* values, const NoiseSettings& settings, const bool is3D) const {
+			float xs[BlockSize];
+			float ys[BlockSize];
+			for (std::size_t first = 0; first < count; first += BlockSize) {
+				const std::size_t n = std::min(BlockSize, count - first);
+				for (std::size_t i = 0; i < n; ++i) {
+					xs[i] = points[first + i].x;
+					ys[i] = points[first + i].y;
+				}
+				EvaluateBlock(xs, ys, z, n, values + first, settings, is3D);
+			}
+		}
+
+		void EvaluateBlock(const float* xs, const float* ys, const float z, const std::size_t n, float* out, const NoiseSettings& settings, const bool is3D) const {
+			float sum[BlockSize] = {};
+			float amplitude = 1.0f, total = 0.0f, frequency = settings.frequency;
+			for (unsigned int octave = 0; octave < settings.octaves; ++octave) {
+				const std::uint32_t seed = OctaveSeed(octave);
+				if (settings.type == NoiseType::Value) {
+					if (is3D) { Value3D(xs, ys, z * frequency, n, frequency, amplitude, seed, sum); }
+					else { Value2D(xs, ys, n, frequency, amplitude, seed, sum); }
+				}
+				else {
+					if (is3D) { Simplex3D(xs, ys, z * frequency, n, frequency, amplitude, seed, sum); }
+					else { Simplex2D(xs, ys, n, frequency, amplitude, seed, sum); }
+				}
+				total += amplitude;
+				amplitude *= settings.gain;
+				frequency *= settings.lacunarity;
+			}
+			const float scale = total > 0.0f ? 1.0f / total : 0.0f;
+			for (std::size_t i = 0; i < n; ++i) {
+				out[i] = sum[i] * scale;
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////
+		//	KERNELS
+		//////////////////////////////////////////////////////////////////////
+
+		// NOTE:
+		// - each kernel adds amplitude * noise(xs[i] * frequency, ys[i] * frequency) to sum[i]
+		// - the loop lives inside the kernel so the whole body is one straight
+		//   loop over the block that the compiler can vectorize
+
+		static int FastFloor(const float x) {
+			const int i = static_cast<int>(x);
+			return i - static_cast<int>(x < static_cast<float>(i));
+		}
+
+		static std::uint32_t Hash(const int x, const int y, const std::uint32_t seed) {
+			std::uint32_t h = seed + static_cast<std::uint32_t>(x) * 0x27D4EB2Du + static_cast<std::uint32_t>(y) * 0x165667B1u;
+			h = (h ^ (h >> 15)) * 0x85EBCA6Bu;
+			h = (h ^ (h >> 13)) * 0xC2B2AE35u;
+			return h ^ (h >> 16);
+		}
+
+		static std::uint32_t Hash(const int x, const int y, const int z, const std::uint32_t seed) {
+			return Hash(x, y, seed + static_cast<std::uint32_t>(z) * 0x9E3779B1u);
+		}
+
+		static float HashToFloat(const std::uint32_t h) {
+			return static_cast<float>(static_cast<std::int32_t>(h & 0xFFFFFFu)) * (2.0f / 16777215.0f) - 1.0f;
+		}
+
+		static float Fade(const float t) {
+			return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+		}
+
+		static float Gradient(const std::uint32_t hash, const float x, const float y) {
+			const std::uint32_t h = hash & 7u;
+			const float u = h < 4u ? x : y;
+			const float v = h < 4u ? y : x;
+			return ((h & 1u) ? -u : u) + ((h & 2u) ? -2.0f * v : 2.0f * v);
+		}
+
+		static float Gradient(const std::uint32_t hash, const float x, const float y, const float z) {
+			const std::uint32_t h = hash & 15u;
+			const float u = h < 8u ? x : y;
+			const float v = h < 4u ? y : ((h == 12u || h == 14u) ? x : z);
+			return ((h & 1u) ? -u : u) + ((h & 2u) ? -v : v);
+		}
+
+		static void Value2D(const float* xs, const float* ys, const std::size_t n, const float frequency, const float amplitude, const std::uint32_t seed, float* sum) {
+			for (std::size_t idx = 0; idx < n; ++idx) {
+				const float x = xs[idx] * frequency;
+				const float y = ys[idx] * frequency;
+				const int ix = FastFloor(x);
+				const int iy = FastFloor(y);
+				const float tx = Fade(x - static_cast<float>(ix));
+				const float ty = Fade(y - static_cast<float>(iy));
+				const float a = Lerp(HashToFloat(Hash(ix, iy, seed)), HashToFloat(Hash(ix + 1, iy, seed)), tx);
+				const float b = Lerp(HashToFloat(Hash(ix, iy + 1, seed)), HashToFloat(Hash(ix + 1, iy + 1, seed)), tx);
+				sum[idx] += amplitude * Lerp(a, b, ty);
+			}
+		}
+
+		static void Value3D(const float* xs, const float* ys, const float z, const std::size_t n, const float frequency, const float amplitude, const std::uint32_t seed, float* sum) {
+			for (std::size_t idx = 0; idx < n; ++idx) {
+				const float x = xs[idx] * frequency;
+				const float y = ys[idx] * frequency;
+				const int ix = FastFloor(x);
+				const int iy = FastFloor(y);
+				const int iz = FastFloor(z);
+				const float tx = Fade(x - static_cast<float>(ix));
+				const float ty = Fade(y - static_cast<float>(iy));
+				const float tz = Fade(z - static_cast<float>(iz));
+				const float a0 = Lerp(HashToFloat(Hash(ix, iy, iz, seed)), HashToFloat(Hash(ix + 1, iy, iz, seed)), tx);
+				const float b0 = Lerp(HashToFloat(Hash(ix, iy + 1, iz, seed)), HashToFloat(Hash(ix + 1, iy + 1, iz, seed)), tx);
+				const float a1 = Lerp(HashToFloat(Hash(ix, iy, iz + 1, seed)), HashToFloat(Hash(ix + 1, iy, iz + 1, seed)), tx);
+				const float b1 = Lerp(HashToFloat(Hash(ix, iy + 1, iz + 1, seed)), HashToFloat(Hash(ix + 1, iy + 1, iz + 1, seed)), tx);
+				sum[idx] += amplitude * Lerp(Lerp(a0, b0, ty), Lerp(a1, b1, ty), tz);
+			}
+		}
+
+		static void Simplex2D(const float* xs, const float* ys, const std::size_t n, const float frequency, const float amplitude, const std::uint32_t seed, float* sum) {
+			constexpr float F2 = 0.366025403f; // (sqrt(3) - 1) / 2
+			constexpr float G2 = 0.211324865f; // (3 - sqrt(3)) / 6
+			for (std::size_t idx = 0; idx < n; ++idx) {
+				const float x = xs[idx] * frequency;
+				const float y = ys[idx] * frequency;
+				const float s = (x + y) * F2;
+				const int i = FastFloor(x + s);
+				const int j = FastFloor(y + s);
+				const float t = static_cast<float>(i + j) * G2;
+				const float x0 = x - (static_cast<float>(i) - t);
+				const float y0 = y - (static_cast<float>(j) - t);
+				const int i1 = x0 > y0 ? 1 : 0;
+				const int j1 = 1 - i1;
+				const float x1 = x0 - static_cast<float>(i1) + G2;
+				const float y1 = y0 - static_cast<float>(j1) + G2;
+				const float x2 = x0 - 1.0f + 2.0f * G2;
+				const float y2 = y0 - 1.0f + 2.0f * G2;
+				const float t0 = std::max(0.0f, 0.5f - x0 * x0 - y0 * y0);
+				const float t1 = std::max(0.0f, 0.5f - x1 * x1 - y1 * y1);
+				const float t2 = std::max(0.0f, 0.5f - x2 * x2 - y2 * y2);
+				const float n0 = (t0 * t0) * (t0 * t0) * Gradient(Hash(i, j, seed), x0, y0);
+				const float n1 = (t1 * t1) * (t1 * t1) * Gradient(Hash(i + i1, j + j1, seed), x1, y1);
+				const float n2 = (t2 * t2) * (t2 * t2) * Gradient(Hash(i + 1, j + 1, seed), x2, y2);
+				sum[idx] += amplitude * 45.0f * (n0 + n1 + n2);
+			}
+		}
+
+		static void Simplex3D(const float* xs, const float* ys, const float z, const std::size_t n, const float frequency, const float amplitude, const std::uint32_t seed, float* sum) {
+			constexpr float F3 = 1.0f / 3.0f;
+			constexpr float G3 = 1.0f / 6.0f;
+			for (std::size_t idx = 0; idx < n; ++idx) {
+				const float x = xs[idx] * frequency;
+				const float y = ys[idx] * frequency;
+				const float s = (x + y + z) * F3;
+				const int i = FastFloor(x + s);
+				const int j = FastFloor(y + s);
+				const int k = FastFloor(z + s);
+				const float t = static_cast<float>(i + j + k) * G3;
+				const float x0 = x - (static_cast<float>(i) - t);
+				const float y0 = y - (static_cast<float>(j) - t);
+				const float z0 = z - (static_cast<float>(k) - t);
+				// the simplex corners are picked by ranking x0, y0 and z0 with
+				// comparisons only so this stays branch free
+				const int xy = x0 >= y0 ? 1 : 0;
+				const int yz = y0 >= z0 ? 1 : 0;
+				const int xz = x0 >= z0 ? 1 : 0;
+				const int i1 = xy & xz;
+				const int j1 = (1 - xy) & yz;
+				const int k1 = (1 - xz) & (1 - yz);
+				const int i2 = xy | xz;
+				const int j2 = (1 - xy) | yz;
+				const int k2 = (1 - xz) | (1 - yz);
+				const float x1 = x0 - static_cast<float>(i1) + G3;
+				const float y1 = y0 - static_cast<float>(j1) + G3;
+				const float z1 = z0 - static_cast<float>(k1) + G3;
+				const float x2 = x0 - static_cast<float>(i2) + 2.0f * G3;
+				const float y2 = y0 - static_cast<float>(j2) + 2.0f * G3;
+				const float z2 = z0 - static_cast<float>(k2) + 2.0f * G3;
+				const float x3 = x0 - 1.0f + 3.0f * G3;
+				const float y3 = y0 - 1.0f + 3.0f * G3;
+				const float z3 = z0 - 1.0f + 3.0f * G3;
+				const float t0 = std::max(0.0f, 0.6f - x0 * x0 - y0 * y0 - z0 * z0);
+				const float t1 = std::max(0.0f, 0.6f - x1 * x1 - y1 * y1 - z1 * z1);
+				const float t2 = std::max(0.0f, 0.6f - x2 * x2 - y2 * y2 - z2 * z2);
+				const float t3 = std::max(0.0f, 0.6f - x3 * x3 - y3 * y3 - z3 * z3);
+				const float n0 = (t0 * t0) * (t0 * t0) * Gradient(Hash(i, j, k, seed), x0, y0, z0);
+				const float n1 = (t1 * t1) * (t1 * t1) * Gradient(Hash(i + i1, j + j1, k + k1, seed), x1, y1, z1);
+				const float n2 = (t2 * t2) * (t2 * t2) * Gradient(Hash(i + i2, j + j2, k + k2, seed), x2, y2, z2);
+				const float n3 = (t3 * t3) * (t3 * t3) * Gradient(Hash(i + 1, j + 1, k + 1, seed), x3, y3, z3);
+				sum[idx] += amplitude * 32.0f * (n0 + n1 + n2 + n3);
+			}
+		}
+
+		std::uint32_t m_seed = 0;
+	};
+
+}
@@ -0,0 +1,305 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CORE FUNCTIONS
+	------------------------------------------------------------
+	-	RoundToInt()
+	-	FloatToHalf()
+	-	HalfToFloat()
+	-	ExpandVertices()
+	-	SetVertexArrayColorIndex()
+	-	SetQuadColorIndex()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		// 12 bytes per vertex instead of 20. every VertexArrayUtils and QuadUtils function works on it
+		std::vector<Arc::FixedVertex> packed(4 * 1000);
+		Arc::MakeGrid(packed, 0, { 40, 25 }, { 16.0f, 16.0f });
+		Arc::SetVertexArrayColor(packed, 0, packed.size(), sf::Color::White);
+
+		// packed texture coordinates are normalized so they are scaled by the texture size on expansion
+		Arc::SetQuadTextureRect(packed, 0, { 0.0f, 0.0f, 0.5f, 0.5f });
+
+		// expand right before drawing
+		std::vector<sf::Vertex> vertices(packed.size());
+		Arc::ExpandVertices(packed.data(), packed.size(), vertices.data(), sf::Vector2f(texture.getSize()));
+		window.draw(vertices.data(), vertices.size(), sf::Quads, &texture);
+
+	}
+
+*/
+
+#include "VertexTraits.hpp"
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	ENCODINGS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - rounds to the nearest integer without a branch or a call to std::round by letting
+	//   the float addition do the rounding. only valid for values within +-2^22
+	inline std::int32_t RoundToInt(const float f) {
+		const float shifted = f + 12582912.0f; // 1.5 * 2^23
+		std::int32_t bits;
+		std::memcpy(&bits, &shifted, sizeof(bits));
+		return bits - 0x4b400000;
+	}
+
+	// NOTE:
+	// - signed 16 bit fixed point. the default of 4 fraction bits covers -2048 to 2047.9375
+	//   in steps of 1/16 which is enough for positions inside a view or a tile layer
+	// - values are rounded on every write so positions that are moved by tiny amounts
+	//   every frame should be kept in float and only written once per frame
+	// - MoveVertexArray() and MoveQuad() round the translation to whole steps once and
+	//   then add integers, which can only differ from rounding every sum by one step
+	//   and only when the translation is within float precision of halfway between two steps
+	template <int FractionBits = 4>
+	struct Fixed16 {
+		static_assert(FractionBits >= 0 && FractionBits < 15, "fraction bits must leave room for the integer part");
+
+		static constexpr float Scale = static_cast<float>(1 << FractionBits);
+
+		std::int16_t value = 0;
+
+		static Fixed16 FromFloat(const float f) {
+			return { static_cast<std::int16_t>(RoundToInt(std::min(std::max(f * Scale, -32768.0f), 32767.0f))) };
+		}
+
+		float ToFloat() const { return static_cast<float>(value) * (1.0f / Scale); }
+
+		// the number of 1 / Scale steps closest to f, limited to what can move a value across the whole range
+		static std::int32_t ToSteps(const float f) {
+			return RoundToInt(std::min(std::max(f * Scale, -65535.0f), 65535.0f));
+		}
+
+		// saturates the same way FromFloat() does
+		static Fixed16 Add(const Fixed16 f, const std::int32_t steps) {
+			return { static_cast<std::int16_t>(std::min(std::max(f.value + steps, -32768), 32767)) };
+		}
+	};
+
+	// unsigned 16 bit value normalized to 0 to 1
+	struct UNorm16 {
+		std::uint16_t value = 0;
+
+		static UNorm16 FromFloat(const float f) {
+			return { static_cast<std::uint16_t>(RoundToInt(std::min(std::max(f, 0.0f), 1.0f) * 65535.0f)) };
+		}
+
+		float ToFloat() const { return static_cast<float>(value) * (1.0f / 65535.0f); }
+	};
+
+	inline std::uint16_t FloatToHalf(const float f) {
+		std::uint32_t u;
+		std::memcpy(&u, &f, sizeof(u));
+		const std::uint32_t sign = u & 0x80000000u;
+		u ^= sign;
+		std::uint16_t h;
+		if (u >= 0x47800000u) { // too large for a half so it becomes infinity (or stays nan)
+			h = u > 0x7f800000u ? 0x7e00 : 0x7c00;
+		}
+		else if (u < 0x38800000u) { // becomes a denormal or zero. the add lets the fpu do the rounding
+			float g;
+			std::memcpy(&g, &u, sizeof(g));
+			g += 0.5f;
+			std::memcpy(&u, &g, sizeof(u));
+			h = static_cast<std::uint16_t>(u - 0x3f000000u);
+		}
+		else { // rebias the exponent and round the mantissa to nearest even
+			const std::uint32_t odd = (u >> 13) & 1u;
+			u += 0xc8000fffu + odd;
+			h = static_cast<std::uint16_t>(u >> 13);
+		}
+		return static_cast<std::uint16_t>(h | (sign >> 16));
+	}
+
+	inline float HalfToFloat(const std::uint16_t h) {
+		std::uint32_t u = static_cast<std::uint32_t>(h & 0x7fff) << 13;
+		const std::uint32_t exponent = u & 0x0f800000u;
+		u += 0x38000000u;
+		if (exponent == 0x0f800000u) { // infinity or nan
+			u += 0x38000000u;
+		}
+		else if (exponent == 0) { // denormal
+			u += 0x00800000u;
+			float f;
+			std::memcpy(&f, &u, sizeof(f));
+			f -= 6.103515625e-05f;
+			std::memcpy(&u, &f, sizeof(u));
+		}
+		u |= static_cast<std::uint32_t>(h & 0x8000) << 16;
+		float result;
+		std::memcpy(&result, &u, sizeof(result));
+		return result;
+	}
+
+	// IEEE 754 half precision float. exact for integers up to 2048 and keeps about 3
+	// significant digits beyond that
+	struct Half {
+		std::uint16_t value = 0;
+
+		static Half FromFloat(const float f) { return { FloatToHalf(f) }; }
+
+		float ToFloat() const { return HalfToFloat(value); }
+	};
+
+	// an index into a palette of up to 256 colors that is looked up on expansion
+	struct PaletteIndex {
+		std::uint8_t value = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//	VERTICES
+	//////////////////////////////////////////////////////////////////////
+
+	template <class E>
+	struct PackedVector2 {
+		E x, y;
+	};
+
+	template <class P, class T, class C>
+	struct BasicPackedVertex {
+		PackedVector2<P> position;
+		PackedVector2<T> texCoords;
+		C color;
+	};
+
+	using FixedVertex = BasicPackedVertex<Fixed16<>, UNorm16, sf::Color>;
+	using HalfVertex = BasicPackedVertex<Half, UNorm16, sf::Color>;
+	using PalettedVertex = BasicPackedVertex<Fixed16<>, UNorm16, PaletteIndex>;
+
+	static_assert(sizeof(FixedVertex) == 12, "FixedVertex should be 12 bytes");
+	static_assert(sizeof(HalfVertex) == 12, "HalfVertex should be 12 bytes");
+	static_assert(sizeof(PalettedVertex) == 10, "PalettedVertex should be 10 bytes");
+
+	// integer translation for fixed point positions (see HasPositionDelta)
+	template <class P>
+	struct PackedPositionTraits {};
+
+	template <int FractionBits>
+	struct PackedPositionTraits<Fixed16<FractionBits>> {
+
+		using Fixed = Fixed16<FractionBits>;
+		using PositionDelta = PackedVector2<std::int32_t>;
+
+		static PositionDelta ToPositionDelta(const sf::Vector2f& translation) { return { Fixed::ToSteps(translation.x), Fixed::ToSteps(translation.y) }; }
+
+		template <class Vertex>
+		static void MovePosition(Vertex& vertex, const PositionDelta& delta) { vertex.position = { Fixed::Add(vertex.position.x, delta.x), Fixed::Add(vertex.position.y, delta.y) }; }
+
+	};
+
+	// NOTE:
+	// - packed texture coordinates are normalized to 0 to 1 and only become texels
+	//   when they are expanded, so texture rects given to SetQuadTextureRect() must be
+	//   divided by the texture size first
+	// - PalettedVertex works with every position and texture coordinate function but
+	//   an sf::Color cannot be written to a palette index, so SetVertexArrayColor(),
+	//   SetQuadColor() and the ColorUtils setters static_assert on it. use
+	//   SetVertexArrayColorIndex() and SetQuadColorIndex() instead and note that
+	//   FromVertex() leaves the index at 0
+	template <class P, class T, class C>
+	struct VertexTraits<BasicPackedVertex<P, T, C>> : PackedPositionTraits<P> {
+
+		using Vertex = BasicPackedVertex<P, T, C>;
+		using ColorType = C;
+
+		static sf::Vector2f GetPosition(const Vertex& vertex) { return { vertex.position.x.ToFloat(), vertex.position.y.ToFloat() }; }
+		static void SetPosition(Vertex& vertex, const sf::Vector2f& position) { vertex.position = { P::FromFloat(position.x), P::FromFloat(position.y) }; }
+
+		static C GetColor(const Vertex& vertex) { return vertex.color; }
+		static void SetColor(Vertex& vertex, const C& color) { vertex.color = color; }
+
+		static sf::Vector2f GetTexCoords(const Vertex& vertex) { return { vertex.texCoords.x.ToFloat(), vertex.texCoords.y.ToFloat() }; }
+		static void SetTexCoords(Vertex& vertex, const sf::Vector2f& texCoords) { vertex.texCoords = { T::FromFloat(texCoords.x), T::FromFloat(texCoords.y) }; }
+
+		static Vertex FromVertex(const sf::Vertex& vertex) {
+			Vertex result{};
+			SetPosition(result, vertex.position);
+			SetTexCoords(result, vertex.texCoords);
+			if constexpr (std::is_same_v<C, sf::Color>) { result.color = vertex.color; }
+			return result;
+		}
+
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//	EXPANSION
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - writes count sf::Vertex to vertices. texture coordinates are multiplied by textureSize
+	// - palette must hold a color for every index used when C is PaletteIndex and is ignored otherwise
+	// - call this once per frame right before drawing so the simulation only ever touches the packed data
+	template <class P, class T, class C>
+	void ExpandVertices(const BasicPackedVertex<P, T, C>* packed, const std::size_t count, sf::Vertex* vertices, const sf::Vector2f& textureSize = { 1.0f, 1.0f }, const sf::Color* palette = nullptr) {
+		const float tw = textureSize.x;
+		const float th = textureSize.y;
+		for (std::size_t i = 0; i < count; ++i) {
+			const BasicPackedVertex<P, T, C> p = packed[i];
+			sf::Vertex& v = vertices[i];
+			v.position = { p.position.x.ToFloat(), p.position.y.ToFloat() };
+			v.texCoords = { p.texCoords.x.ToFloat() * tw, p.texCoords.y.ToFloat() * th };
+			if constexpr (std::is_same_v<C, PaletteIndex>) { v.color = palette[p.color.value]; }
+			else { v.color = p.color; }
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	PALETTE INDICES
+	//////////////////////////////////////////////////////////////////////
+
+	template <class V>
+	void SetVertexArrayColorIndex(V& vertices, const std::size_t start, const std::size_t count, const std::uint8_t index) {
+		std::size_t idx = start;
+		for (std::size_t i = 0; i < count; ++i) {
+			vertices[idx].color = PaletteIndex{ index };
+			++idx;
+		}
+	}
+
+	template <class V>
+	void SetQuadColorIndex(V& vertices, const std::size_t id, const std::uint8_t index) {
+		SetVertexArrayColorIndex(vertices, id * 4, 4, index);
+	}
+
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			POLYLINES
+	------------------------------------------------------------
+	-	GetPolylineQuadCount()
+	-	GetPolylineVertexCount()
+	-	GetPolylineArcDirections()
+	-	MakePolyline()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		const std::vector<sf::Vector2f> points = { { 100.0f, 100.0f }, { 300.0f, 150.0f }, { 350.0f, 400.0f }, { 600.0f, 300.0f } };
+
+		// the size is known before anything is made so the array is only sized once
+		sf::VertexArray vertices(sf::Quads, Arc::GetPolylineVertexCount(points.size(), Arc::LineJoin::Round, Arc::LineCap::Square));
+		Arc::MakePolyline(vertices, 0, points.data(), points.size(), 8.0f, Arc::LineJoin::Round, Arc::LineCap::Square);
+
+	}
+
+*/
+
+#include "QuadUtils.hpp"
+#include <cstddef>
+
+namespace Arc {
+
+	enum class LineJoin {
+		Miter,
+		Bevel,
+		Round
+	};
+
+	enum class LineCap {
+		Butt,
+		Square,
+		Round
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//	POLYLINES
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - every segment is one quad, every miter or bevel join is one quad and every
+	//   round join or round cap is 4 quads (quads that fill a triangle repeat a corner)
+	// - the count only depends on these arguments so it never changes with the shape
+	//   of the line and a vertex array sized with it can be reused every frame
+	inline std::size_t GetPolylineQuadCount(const std::size_t pointCount, const LineJoin join = LineJoin::Miter, const LineCap cap = LineCap::Butt) {
+		if (pointCount < 2) { return 0; }
+		const std::size_t roundQuads = 4;
+		const std::size_t segments = pointCount - 1;
+		const std::size_t joins = pointCount - 2;
+		const std::size_t joinQuads = join == LineJoin::Round ? roundQuads : 1;
+		const std::size_t capQuads = cap == LineCap::Round ? 2 * roundQuads : 0;
+		return segments + joins * joinQuads + capQuads;
+	}
+
+	inline std::size_t GetPolylineVertexCount(const std::size_t pointCount, const LineJoin join = LineJoin::Miter, const LineCap cap = LineCap::Butt) {
+		return 4 * GetPolylineQuadCount(pointCount, join, cap);
+	}
+
+	// NOTE:
+	// - fills dirs with 9 unit vectors going from a to b (less than 180 degrees apart)
+	//   by repeatedly normalizing the sum of two neighbours so no trig is needed.
+	//   mid is used as the halfway direction when a and b point in opposite directions
+	inline void GetPolylineArcDirections(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& mid, sf::Vector2f* dirs) {
+		auto bisect = [](const sf::Vector2f& u, const sf::Vector2f& v, const sf::Vector2f& fallback) {
+			const sf::Vector2f s = u + v;
+			const float len2 = GetDotProduct(s, s);
+			return len2 > 1e-8f ? (1.0f / std::sqrt(len2)) * s : fallback;
+		};
+		dirs[0] = a;
+		dirs[8] = b;
+		dirs[4] = bisect(a, b, mid);
+		for (std::size_t step = 4; step > 1; step /= 2) {
+			for (std::size_t i = step / 2; i < 8; i += step) {
+				dirs[i] = bisect(dirs[i - step / 2], dirs[i + step / 2], dirs[i - step / 2]);
+			}
+		}
+	}
+
+	// NOTE:
+	// - writes GetPolylineQuadCount(pointCount, join, cap) quads starting at quad
+	//   start (the same as Arc::MakeGrid()) so the array should be drawn as sf::Quads
+	// - segment normals come straight from the normalized direction vectors and the
+	//   whole line is made in one pass over the points without any trig
+	// - miter joins longer than miterLimit * thickness / 2 are drawn as bevels
+	template <class V>
+	void MakePolyline(V& vertices, const std::size_t start, const sf::Vector2f* points, const std::size_t pointCount, const float thickness, const LineJoin join = LineJoin::Miter, const LineCap cap = LineCap::Butt, const float miterLimit = 4.0f) {
+		if (pointCount < 2) { return; }
+		const float h = 0.5f * thickness;
+		std::size_t idx = start * 4;
+
+		auto put = [&](const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& c, const sf::Vector2f& d) {
+			vertices[idx + 0].position = a;
+			vertices[idx + 1].position = b;
+			vertices[idx + 2].position = c;
+			vertices[idx + 3].position = d;
+			idx += 4;
+		};
+
+		// a fan of 4 quads around pivot where each quad covers two of the 8 arc steps
+		auto putArc = [&](const sf::Vector2f& pivot, const sf::Vector2f* dirs) {
+			for (std::size_t i = 0; i < 8; i += 2) {
+				put(pivot, pivot + h * dirs[i], pivot + h * dirs[i + 1], pivot + h * dirs[i + 2]);
+			}
+		};
+
+		// zero length segments keep the direction of the one before them
+		sf::Vector2f dir = { 1.0f, 0.0f };
+		auto direction = [&](const std::size_t i) {
+			const sf::Vector2f d = points[i + 1] - points[i];
+			const float len2 = GetDotProduct(d, d);
+			if (len2 > 1e-12f) { dir = (1.0f / std::sqrt(len2)) * d; }
+			return dir;
+		};
+
+		sf::Vector2f d0 = direction(0);
+		for (std::size_t i = 0; i + 1 < pointCount; ++i) {
+			const sf::Vector2f d = i == 0 ? d0 : direction(i);
+			const sf::Vector2f n = { -d.y, d.x };
+
+			// join with the previous segment
+			if (i > 0) {
+				const sf::Vector2f pivot = points[i];
+				const sf::Vector2f n0 = { -d0.y, d0.x };
+				// the outer side of the turn is the side the line bends away from
+				const float side = GetCrossProduct(d0, d) > 0.0f ? -1.0f : 1.0f;
+				const sf::Vector2f outer0 = side * n0;
+				const sf::Vector2f outer1 = side * n;
+				if (join == LineJoin::Round) {
+					sf::Vector2f dirs[9];
+					GetPolylineArcDirections(outer0, outer1, d0, dirs);
+					putArc(pivot, dirs);
+				}
+				else {
+					const sf::Vector2f a = pivot + h * outer0;
+					const sf::Vector2f b = pivot + h * outer1;
+					sf::Vector2f tip = 0.5f * (a + b);
+					if (join == LineJoin::Miter) {
+						const sf::Vector2f m = outer0 + outer1;
+						const float len2 = GetDotProduct(m, m);
+						if (len2 > 1e-8f) {
+							const sf::Vector2f miter = (1.0f / std::sqrt(len2)) * m;
+							const float cosHalf = GetDotProduct(miter, outer0);
+							if (cosHalf > 0.0f && 1.0f / cosHalf <= miterLimit) {
+								tip = pivot + (h / cosHalf) * miter;
+							}
+						}
+					}
+					put(pivot, a, tip, b);
+				}
+			}
+
+			// the segment itself. square caps push the ends out by half the thickness
+			sf::Vector2f p0 = points[i];
+			sf::Vector2f p1 = points[i + 1];
+			if (cap == LineCap::Square) {
+				if (i == 0) { p0 -= h * d; }
+				if (i + 2 == pointCount) { p1 += h * d; }
+			}
+			put(p0 + h * n, p1 + h * n, p1 - h * n, p0 - h * n);
+
+			if (cap == LineCap::Round) {
+				sf::Vector2f dirs[9];
+				if (i == 0) {
+					GetPolylineArcDirections(n, -n, -d, dirs);
+					putArc(points[0], dirs);
+				}
+				if (i + 2 == pointCount) {
+					GetPolylineArcDirections(-n, n, d, dirs);
+					putArc(points[pointCount - 1], dirs);
+				}
+			}
+			d0 = d;
+		}
+	}
+
+}
@@ -0,0 +1,322 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Add()
+	-	Bind()
+	-	LoadManifest()
+	-	Preload()
+	-	GetEntryCount()
+	-	Clear()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::ResourceManager<std::string, sf::Texture> textures;
+		Arc::ResourceManager<std::string, sf::Font> fonts;
+		Arc::ResourceManager<std::string, sf::SoundBuffer> sounds;
+
+		Arc::Preloader preloader;
+
+		// either list the resources in code, in the order they are needed
+		preloader.Add(textures, "player", "resources/player.png");
+		preloader.Add(fonts, "hud", "resources/font.ttf");
+
+		// or read them from a manifest where each line is "<type> <id> <path>"
+		//
+		//     texture  player  resources/player.png
+		//     sound    jump    resources/jump.wav
+		//
+		preloader.Bind("texture", textures);
+		preloader.Bind("font", fonts);
+		preloader.Bind("sound", sounds);
+		preloader.LoadManifest("resources/level1.txt");
+
+		// decodes on every core and calls back on this thread as each resource is ready
+		const std::size_t failed = preloader.Preload([](const Arc::PreloadProgress& progress) {
+			if (progress.failed) { std::cout << "could not load " << progress.file << "\n"; }
+			DrawLoadingBar(static_cast<float>(progress.completed) / static_cast<float>(progress.total));
+		});
+
+	}
+
+*/
+
+#include "JobSystem.hpp"
+#include "Profiling.hpp"
+#include "ResourceManager.hpp"
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace Arc {
+
+	// NOTE:
+	// - splits loading a resource into Decode(), which runs on a worker thread, and Finish(),
+	//   which runs on the thread that called Preload() and is where anything that needs the
+	//   OpenGL context happens
+	// - the default decodes the whole resource on the worker and copies it into the manager.
+	//   specialize it for other resource types
+	template <class R>
+	struct PreloadTraits {
+		using Decoded = R;
+		static bool Decode(const std::string& file, Decoded& decoded) { return decoded.loadFromFile(file); }
+		static bool Finish(const std::string&, const Decoded& decoded, R& resource) {
+			resource = decoded;
+			return true;
+		}
+	};
+
+	// images are decoded on the workers and only uploaded on the calling thread
+	template <>
+	struct PreloadTraits<sf::Texture> {
+		using Decoded = sf::Image;
+		static bool Decode(const std::string& file, Decoded& decoded) { return decoded.loadFromFile(file); }
+		static bool Finish(const std::string&, const Decoded& decoded, sf::Texture& resource) { return resource.loadFromImage(decoded); }
+	};
+
+	// fonts only open the file when loaded and render glyphs on demand so there is nothing to decode ahead
+	template <>
+	struct PreloadTraits<sf::Font> {
+		struct Decoded {};
+		static bool Decode(const std::string&, Decoded&) { return true; }
+		static bool Finish(const std::string& file, const Decoded&, sf::Font& resource) { return resource.loadFromFile(file); }
+	};
+
+	// samples are decoded on the workers and only handed to the audio device on the calling thread
+	template <>
+	struct PreloadTraits<sf::SoundBuffer> {
+		struct Decoded {
+			std::vector<sf::Int16> samples;
+			unsigned int channelCount = 0;
+			unsigned int sampleRate = 0;
+		};
+		static bool Decode(const std::string& file, Decoded& decoded) {
+			sf::InputSoundFile input;
+			if (!input.openFromFile(file)) { return false; }
+			decoded.samples.resize(static_cast<std::size_t>(input.getSampleCount()));
+			decoded.samples.resize(static_cast<std::size_t>(input.read(decoded.samples.data(), decoded.samples.size())));
+			decoded.channelCount = input.getChannelCount();
+			decoded.sampleRate = input.getSampleRate();
+			return true;
+		}
+		static bool Finish(const std::string&, const Decoded& decoded, sf::SoundBuffer& resource) {
+			return resource.loadFromSamples(decoded.samples.data(), decoded.samples.size(), decoded.channelCount, decoded.sampleRate);
+		}
+	};
+
+	struct PreloadProgress {
+		std::size_t completed = 0; // entries finished so far, including failed ones
+		std::size_t total = 0;
+		std::string file; // the file that was just finished
+		bool failed = false;
+	};
+
+	// NOTE:
+	// - collects resources for several ResourceManagers and loads all of them in one Preload()
+	// - a file added more than once for the same resource type is decoded once and given to
+	//   every id that asked for it
+	// - files are decoded in the order they were added, by the workers and the calling thread,
+	//   and finished strictly in that order so the first resources are ready first
+	// - ids that already have a resource in their manager are skipped
+	template <class I>
+	class BasicPreloader {
+	public:
+
+		using ProgressCallback = std::function<void(const PreloadProgress&)>;
+
+		BasicPreloader() = default;
+
+		template <class R>
+		void Add(ResourceManager<I, R>& manager, const I& id, const std::string& file) {
+			manager.AddFile(id, file);
+			const std::string key = std::string(typeid(R).name()) + '\n' + file;
+			auto found = m_lookup.find(key);
+			if (found == m_lookup.end()) {
+				m_jobs.push_back(std::make_unique<Job<R>>());
+				m_jobs.back()->file = file;
+				found = m_lookup.emplace(key, m_jobs.back().get()).first;
+			}
+			static_cast<Job<R>*>(found->second)->targets.push_back({ &manager, id });
+			++m_entries;
+		}
+
+		// lets LoadManifest() add entries of this type to the manager
+		template <class R>
+		void Bind(const std::string& type, ResourceManager<I, R>& manager) {
+			m_bindings[type] = [this, &manager](const I& id, const std::string& file) { Add(manager, id, file); };
+		}
+
+		// NOTE:
+		// - reads "<type> <id> <path>" lines. the path is the rest of the line so it may contain
+		//   spaces. empty lines and lines starting with # are skipped
+		// - returns false if the file could not be opened or a line uses a type that was not bound
+		bool LoadManifest(const std::string& file) {
+			std::ifstream stream(file);
+			if (!stream) { return false; }
+			bool success = true;
+			std::string line;
+			while (std::getline(stream, line)) {
+				if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+				std::istringstream words(line);
+				std::string type;
+				if (!(words >> type) || type[0] == '#') { continue; }
+				I id;
+				std::string path;
+				if (!(words >> id) || !(words >> std::ws) || !std::getline(words, path)) {
+					success = false;
+					continue;
+				}
+				const auto binding = m_bindings.find(type);
+				if (binding == m_bindings.end()) {
+					success = false;
+					continue;
+				}
+				binding->second(id, path);
+			}
+			return success;
+		}
+
+		// NOTE:
+		// - blocks until every entry is loaded and returns how many failed. callback is called
+		//   on this thread once per entry, in the order the entries were added
+		// - the files are decoded on GetJobSystem() and this thread helps while it waits
+		// - the entries are cleared afterwards
+		std::size_t Preload(const ProgressCallback& callback = {}) {
+			ARC_PROFILE_SCOPE("Preloader::Preload");
+			// checked before decoding starts since the managers are written to while it runs
+			for (const std::unique_ptr<JobBase>& job : m_jobs) { job->needed = job->IsNeeded(); }
+
+			JobSystem& jobSystem = GetJobSystem();
+			std::vector<JobHandle> decodes;
+			decodes.reserve(m_jobs.size());
+			for (const std::unique_ptr<JobBase>& job : m_jobs) {
+				JobBase* base = job.get();
+				decodes.push_back(jobSystem.Schedule([base]() { base->success = !base->needed || base->Decode(); }));
+			}
+
+			PreloadProgress progress;
+			progress.total = m_entries;
+			std::size_t failed = 0;
+			for (std::size_t i = 0; i < m_jobs.size(); ++i) {
+				const std::unique_ptr<JobBase>& job = m_jobs[i];
+				jobSystem.Wait(decodes[i]);
+				job->Finish([&](const bool success) {
+					++progress.completed;
+					progress.file = job->file;
+					progress.failed = !success;
+					if (!success) { ++failed; }
+					if (callback) { callback(progress); }
+				});
+			}
+			Clear();
+			return failed;
+		}
+
+		std::size_t GetEntryCount() const { return m_entries; }
+
+		// removes the entries. the bindings are kept
+		void Clear() {
+			m_jobs.clear();
+			m_lookup.clear();
+			m_entries = 0;
+		}
+
+	private:
+
+		struct JobBase {
+			virtual ~JobBase() = default;
+			virtual bool IsNeeded() const = 0;
+			virtual bool Decode() = 0;
+			virtual void Finish(const std::function<void(bool)>& report) = 0;
+
+			std::string file;
+			bool needed = true;
+			bool success = false;
+		};
+
+		template <class R>
+		struct Job : JobBase {
+			using Traits = PreloadTraits<R>;
+
+			bool IsNeeded() const override {
+				return std::any_of(targets.begin(), targets.end(), [](const Target& target) { return !target.manager->HasResource(target.id); });
+			}
+
+			bool Decode() override {
+				return Traits::Decode(this->file, data);
+			}
+
+			void Finish(const std::function<void(bool)>& report) override {
+				for (const Target& target : targets) {
+					if (target.manager->HasResource(target.id)) {
+						report(true);
+						continue;
+					}
+					R resource;
+					const bool success = this->success && Traits::Finish(this->file, data, resource) && target.manager->InsertResource(target.id, std::move(resource)) != nullptr;
+					if (success) { ARC_PROFILE_COUNT(ProfileCounter::ResourceLoads, 1); }
+					report(success);
+				}
+				data = {};
+			}
+
+			struct Target {
+				ResourceManager<I, R>* manager;
+				I id;
+			};
+
+			std::vector<Target> targets;
+			typename Traits::Decoded data;
+		};
+
+		std::vector<std::unique_ptr<JobBase>> m_jobs; // in the order they were added
+		std::unordered_map<std::string, JobBase*> m_lookup; // resource type and file to job
+		std::unordered_map<std::string, std::function<void(const I&, const std::string&)>> m_bindings;
+		std::size_t m_entries = 0;
+	};
+
+	using Preloader = BasicPreloader<std::string>;
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CORE FUNCTIONS
+	------------------------------------------------------------
+	-	DrawProfilerOverlay()
+
+*/
+
+#include "Profiling.hpp"
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <algorithm>
+#include <string>
+
+namespace Arc {
+
+	// NOTE:
+	// - draws every counter and the total time of each named timer on top of
+	//   whatever view the target currently has
+	// - this is a debugging aid and is not written to be fast
+	// - draws nothing when ARC_ENABLE_PROFILING is undefined
+#if defined(ARC_ENABLE_PROFILING)
+	inline void DrawProfilerOverlay(sf::RenderTarget& target, const sf::Font& font, const sf::Vector2f& position = { 8.0f, 8.0f }, const unsigned int characterSize = 12) {
+		const ProfileSnapshot snapshot = GetProfiler().GetSnapshot();
+		std::string lines;
+		for (std::size_t i = 0; i < snapshot.counters.size(); ++i) {
+			lines += std::string(GetProfileCounterName(static_cast<ProfileCounter>(i))) + ": " + std::to_string(snapshot.counters[i]) + "\n";
+		}
+		std::vector<std::pair<std::string, std::int64_t>> totals;
+		for (const ProfileEvent& evt : snapshot.events) {
+			auto itr = std::find_if(totals.begin(), totals.end(), [&](const auto& t) { return t.first == evt.name; });
+			if (itr == totals.end()) { totals.emplace_back(evt.name, evt.duration); }
+			else { itr->second += evt.duration; }
+		}
+		for (const auto& total : totals) {
+			lines += total.first + ": " + std::to_string(total.second) + " us\n";
+		}
+
+		const float lineCount = static_cast<float>(snapshot.counters.size() + totals.size());
+		sf::RectangleShape background({ 320.0f, (lineCount + 1.0f) * static_cast<float>(characterSize) * 1.25f });
+		background.setPosition(position);
+		background.setFillColor(sf::Color(0, 0, 0, 160));
+
+		sf::Text text(lines, font, characterSize);
+		text.setPosition({ position.x + 4.0f, position.y + 4.0f });
+		text.setFillColor(sf::Color::White);
+
+		target.draw(background);
+		target.draw(text);
+	}
+#else
+	inline void DrawProfilerOverlay(sf::RenderTarget&, const sf::Font&, const sf::Vector2f& = { 8.0f, 8.0f }, const unsigned int = 12) {}
+#endif
+
+}
@@ -0,0 +1,290 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			MACROS
+	------------------------------------------------------------
+	-	ARC_ENABLE_PROFILING
+	-	ARC_PROFILE_COUNT()
+	-	ARC_PROFILE_SCOPE()
+
+	------------------------------------------------------------
+			CORE FUNCTIONS
+	------------------------------------------------------------
+	-	GetProfiler()
+	-	GetProfileCounterName()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Add()
+	-	Record()
+	-	GetSnapshot()
+	-	Reset()
+	-	SetEventCapacity()
+	-	GetEventCapacity()
+	-	ExportChromeTrace()
+	-	SaveChromeTrace()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	// profiling is off unless this is defined before any Arc header is included.
+	// GetProfiler() and the types it uses only exist when it is
+	#define ARC_ENABLE_PROFILING
+	#include "Arc/Arc.hpp"
+
+	void UpdateWorld() {
+		ARC_PROFILE_SCOPE("UpdateWorld"); // timed until the end of the function
+		// ...
+	}
+
+	int main() {
+
+		UpdateWorld();
+
+		const Arc::ProfileSnapshot snapshot = Arc::GetProfiler().GetSnapshot();
+		std::uint64_t touched = snapshot.counters[static_cast<std::size_t>(Arc::ProfileCounter::VertexArrayVertices)];
+
+		// open this in chrome://tracing or https://ui.perfetto.dev
+		Arc::GetProfiler().SaveChromeTrace("trace.json");
+
+	}
+
+*/
+
+// NOTE:
+// - with ARC_ENABLE_PROFILING undefined this header only defines the macros and they compile
+//   to nothing, so the headers that count their work do not pull in the profiler, its
+//   includes or any of the types below
+#if !defined(ARC_ENABLE_PROFILING)
+
+	#define ARC_PROFILE_COUNT(counter, amount) ((void)0)
+	#define ARC_PROFILE_SCOPE(name) ((void)0)
+
+#else
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+	#define ARC_PROFILE_CONCAT_IMPL(a, b) a##b
+	#define ARC_PROFILE_CONCAT(a, b) ARC_PROFILE_CONCAT_IMPL(a, b)
+	#define ARC_PROFILE_COUNT(counter, amount) ::Arc::GetProfiler().Add(counter, static_cast<std::uint64_t>(amount))
+	#define ARC_PROFILE_SCOPE(name) ::Arc::ScopedTimer ARC_PROFILE_CONCAT(arc_scoped_timer_, __LINE__)(name)
+
+namespace Arc {
+
+	enum class ProfileCounter {
+		VertexArrayVertices,	// vertices touched by VertexArrayUtils functions
+		QuadVertices,			// vertices touched by QuadUtils functions (most of them are also counted as VertexArrayVertices)
+		RandomDraws,			// numbers drawn from RandomGenerator distributions
+		ResourceLoads,			// resources loaded from file by ResourceManager
+		ResourceHits,			// LoadResource() calls that found the resource already loaded
+		ResourceMisses,			// LoadResource() calls that had to load or could not find the file
+		AtlasEdits,				// BasicTextureAtlas::EditCell() calls
+		Count
+	};
+
+	inline const char* GetProfileCounterName(const ProfileCounter counter) {
+		constexpr const char* names[] = { "VertexArrayVertices", "QuadVertices", "RandomDraws", "ResourceLoads", "ResourceHits", "ResourceMisses", "AtlasEdits" };
+		static_assert(sizeof(names) / sizeof(names[0]) == static_cast<std::size_t>(ProfileCounter::Count), "every counter needs a name");
+		return names[static_cast<std::size_t>(counter)];
+	}
+
+	struct ProfileEvent {
+		const char* name = "";
+		std::int64_t start = 0;		// microseconds since the profiler was created
+		std::int64_t duration = 0;	// microseconds
+		std::uint32_t thread = 0;
+	};
+
+	struct ProfileSnapshot {
+		std::array<std::uint64_t, static_cast<std::size_t>(ProfileCounter::Count)> counters = {};
+		std::vector<ProfileEvent> events;
+	};
+
+	// NOTE:
+	// - counters are atomics so Arc can be used from several threads. timer events
+	//   are appended under a lock when a ScopedTimer ends
+	// - timer events are kept in a ring buffer. once it is full the oldest events are
+	//   overwritten so a long session does not grow without bound
+	class Profiler {
+	public:
+
+		Profiler() : m_epoch(std::chrono::steady_clock::now()) {}
+
+		void Add(const ProfileCounter counter, const std::uint64_t amount) {
+			m_counters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+		}
+
+		void Record(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end) {
+			ProfileEvent evt;
+			evt.name = name;
+			evt.start = std::chrono::duration_cast<std::chrono::microseconds>(start - m_epoch).count();
+			evt.duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+			evt.thread = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_capacity == 0) { return; }
+			if (m_events.size() < m_capacity) {
+				m_events.push_back(evt);
+				return;
+			}
+			m_events[m_next] = evt;
+			m_next = (m_next + 1) % m_capacity;
+		}
+
+		ProfileSnapshot GetSnapshot() const {
+			ProfileSnapshot snapshot;
+			for (std::size_t i = 0; i < snapshot.counters.size(); ++i) {
+				snapshot.counters[i] = m_counters[i].load(std::memory_order_relaxed);
+			}
+			std::lock_guard<std::mutex> lock(m_mutex);
+			// oldest first
+			snapshot.events.reserve(m_events.size());
+			snapshot.events.insert(snapshot.events.end(), m_events.begin() + static_cast<std::ptrdiff_t>(m_next), m_events.end());
+			snapshot.events.insert(snapshot.events.end(), m_events.begin(), m_events.begin() + static_cast<std::ptrdiff_t>(m_next));
+			return snapshot;
+		}
+
+		void Reset() {
+			for (auto& counter : m_counters) {
+				counter.store(0, std::memory_order_relaxed);
+			}
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_events.clear();
+			m_next = 0;
+		}
+
+		// NOTE:
+		// - the most timer events kept. the newest ones are kept when it shrinks and
+		//   0 stops recording events
+		void SetEventCapacity(const std::size_t capacity) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			std::vector<ProfileEvent> events;
+			const std::size_t kept = std::min(capacity, m_events.size());
+			events.reserve(kept);
+			for (std::size_t i = m_events.size() - kept; i < m_events.size(); ++i) { events.push_back(m_events[(m_next + i) % m_events.size()]); }
+			m_events.swap(events);
+			m_next = 0;
+			m_capacity = capacity;
+		}
+
+		std::size_t GetEventCapacity() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_capacity;
+		}
+
+		// NOTE:
+		// - writes the chrome trace event format. timers become complete ("X") events
+		//   and the counters are written once as a counter ("C") event
+		void ExportChromeTrace(std::ostream& stream) const {
+			const ProfileSnapshot snapshot = GetSnapshot();
+			stream << "{\"traceEvents\":[";
+			bool first = true;
+			for (const ProfileEvent& evt : snapshot.events) {
+				stream << (first ? "" : ",") << "\n{\"name\":";
+				WriteJsonString(stream, evt.name);
+				stream << ",\"cat\":\"Arc\",\"ph\":\"X\",\"pid\":0,\"tid\":" << evt.thread << ",\"ts\":" << evt.start << ",\"dur\":" << evt.duration << "}";
+				first = false;
+			}
+			const std::int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+			stream << (first ? "" : ",") << "\n{\"name\":\"Arc Counters\",\"ph\":\"C\",\"pid\":0,\"tid\":0,\"ts\":" << now << ",\"args\":{";
+			for (std::size_t i = 0; i < snapshot.counters.size(); ++i) {
+				stream << (i == 0 ? "" : ",") << "\"" << GetProfileCounterName(static_cast<ProfileCounter>(i)) << "\":" << snapshot.counters[i];
+			}
+			stream << "}}\n]}\n";
+		}
+
+		bool SaveChromeTrace(const std::string& file) const {
+			std::ofstream stream(file);
+			if (!stream) { return false; }
+			ExportChromeTrace(stream);
+			return static_cast<bool>(stream);
+		}
+
+	private:
+
+		static void WriteJsonString(std::ostream& stream, const char* text) {
+			static constexpr char hex[] = "0123456789abcdef";
+			stream << '"';
+			for (const char* c = text; *c != '\0'; ++c) {
+				const unsigned char byte = static_cast<unsigned char>(*c);
+				if (byte == '"' || byte == '\\') { stream << '\\' << *c; }
+				else if (byte < 0x20) { stream << "\\u00" << hex[byte >> 4] << hex[byte & 15]; }
+				else { stream << *c; }
+			}
+			stream << '"';
+		}
+
+		std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(ProfileCounter::Count)> m_counters = {};
+		std::chrono::steady_clock::time_point m_epoch;
+		mutable std::mutex m_mutex;
+		std::vector<ProfileEvent> m_events;
+		std::size_t m_next = 0; // the oldest event once m_events is full
+		std::size_t m_capacity = 1 << 16;
+	};
+
+	inline Profiler& GetProfiler() {
+		static Profiler profiler;
+		return profiler;
+	}
+
+	// NOTE:
+	// - name must outlive the profiler (a string literal is the usual choice)
+	class ScopedTimer {
+	public:
+
+		explicit ScopedTimer(const char* name) : m_profiler(GetProfiler()), m_name(name), m_start(std::chrono::steady_clock::now()) {}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator = (const ScopedTimer&) = delete;
+
+		~ScopedTimer() {
+			m_profiler.Record(m_name, m_start, std::chrono::steady_clock::now());
+		}
+
+	private:
+		Profiler& m_profiler;
+		const char* m_name;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+}
+
+#endif
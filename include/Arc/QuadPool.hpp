@@ -0,0 +1,305 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Allocate()
+	-	Release()
+	-	IsAlive()
+	-	GetQuad()
+	-	GetQuadIndex()
+	-	Defragment()
+	-	ShrinkToFit()
+	-	Clear()
+	-	Draw()
+	-	GetChunkCount()
+	-	GetChunk()
+	-	GetChunkQuadCount()
+	-	GetLiveCount()
+	-	GetStats()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::QuadPool pool;
+
+		// a handle stays valid until it is released, even across Defragment()
+		Arc::QuadHandle handle = pool.Allocate();
+		sf::Vertex* quad = pool.GetQuad(handle);
+		Arc::MakeQuad(quad, 0, { 100.0f, 100.0f }, { 16.0f, 16.0f });
+		Arc::SetQuadColor(quad, 0, sf::Color::Red);
+
+		pool.Release(handle); // the slot is reset to a transparent quad and reused by the next Allocate()
+
+		// once many quads have been released, move the live ones to the front so less is drawn
+		if (pool.GetStats().occupancy < 0.5f) { pool.Defragment(); }
+
+		pool.Draw(window);
+
+	}
+
+*/
+
+#include "VertexArrayUtils.hpp"
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Arc {
+
+	struct QuadHandle {
+		static constexpr std::uint32_t InvalidIndex = 0xffffffffu;
+
+		std::uint32_t index = InvalidIndex;
+		std::uint32_t generation = 0;
+
+		bool IsValid() const { return index != InvalidIndex; }
+	};
+
+	struct QuadPoolStats {
+		std::size_t capacity = 0;	// quads that fit in the allocated chunks
+		std::size_t live = 0;		// quads currently handed out
+		std::size_t extent = 0;		// one past the highest slot in use. this is what Draw() draws
+		std::size_t holes = 0;		// free slots below extent
+		std::size_t chunks = 0;
+		float occupancy = 1.0f;		// live / extent. defragmenting brings this back to 1
+	};
+
+	// NOTE:
+	// - vertices live in fixed size chunks of Q quads that are never moved or reallocated,
+	//   so growing the pool does not copy live quads and pointers from GetQuad() stay
+	//   valid until the next Defragment()
+	// - handles point into a table that maps them to slots. Defragment() moves quads and
+	//   only rewrites the table, so handles stay valid across it. released handles are
+	//   detected by their generation
+	// - released slots are reset to transparent quads so the whole extent can be drawn
+	//   without skipping holes
+	template <class V = sf::Vertex, std::size_t Q = 1024>
+	class BasicQuadPool {
+	public:
+
+		using Chunk = std::array<V, 4 * Q>;
+
+		BasicQuadPool() = default;
+
+		QuadHandle Allocate() {
+			if (m_freeSlots.empty()) { AddChunk(); }
+			const std::uint32_t slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+
+			std::uint32_t handle;
+			if (m_freeHandles.empty()) {
+				handle = static_cast<std::uint32_t>(m_handles.size());
+				m_handles.push_back({});
+			}
+			else {
+				handle = m_freeHandles.back();
+				m_freeHandles.pop_back();
+			}
+			m_handles[handle].slot = slot;
+			m_owners[slot] = handle;
+			m_extent = std::max(m_extent, static_cast<std::size_t>(slot) + 1);
+			++m_live;
+			return { handle, m_handles[handle].generation };
+		}
+
+		bool Release(const QuadHandle& handle) {
+			if (!IsAlive(handle)) { return false; }
+			Entry& entry = m_handles[handle.index];
+			ResetSlot(entry.slot);
+			m_owners[entry.slot] = QuadHandle::InvalidIndex;
+			m_freeSlots.push_back(entry.slot);
+			entry.slot = QuadHandle::InvalidIndex;
+			++entry.generation;
+			m_freeHandles.push_back(handle.index);
+			--m_live;
+			while (m_extent > 0 && m_owners[m_extent - 1] == QuadHandle::InvalidIndex) { --m_extent; }
+			return true;
+		}
+
+		bool IsAlive(const QuadHandle& handle) const {
+			return handle.index < m_handles.size() && m_handles[handle.index].generation == handle.generation && m_handles[handle.index].slot != QuadHandle::InvalidIndex;
+		}
+
+		// NOTE:
+		// - returns the quad's 4 vertices. pass it to any QuadUtils function with id 0
+		// - returns nullptr for released or invalid handles
+		V* GetQuad(const QuadHandle& handle) {
+			if (!IsAlive(handle)) { return nullptr; }
+			const std::uint32_t slot = m_handles[handle.index].slot;
+			return &(*m_chunks[slot / Q])[(slot % Q) * 4];
+		}
+
+		const V* GetQuad(const QuadHandle& handle) const {
+			if (!IsAlive(handle)) { return nullptr; }
+			const std::uint32_t slot = m_handles[handle.index].slot;
+			return &(*m_chunks[slot / Q])[(slot % Q) * 4];
+		}
+
+		// the slot the quad currently occupies. this changes when the pool is defragmented.
+		// returns QuadHandle::InvalidIndex for released or invalid handles
+		std::size_t GetQuadIndex(const QuadHandle& handle) const {
+			if (!IsAlive(handle)) { return QuadHandle::InvalidIndex; }
+			return m_handles[handle.index].slot;
+		}
+
+		// NOTE:
+		// - moves the live quads into the lowest slots so the extent equals the live count.
+		//   each quad is moved at most once, from the highest live slot into the lowest hole
+		void Defragment() {
+			std::size_t hole = 0;
+			std::size_t last = m_extent;
+			while (true) {
+				while (hole < last && m_owners[hole] != QuadHandle::InvalidIndex) { ++hole; }
+				while (last > hole && m_owners[last - 1] == QuadHandle::InvalidIndex) { --last; }
+				if (hole + 1 >= last) { break; }
+				const std::uint32_t from = static_cast<std::uint32_t>(last - 1);
+				const std::uint32_t to = static_cast<std::uint32_t>(hole);
+				std::copy_n(GetSlot(from), 4, GetSlot(to));
+				ResetSlot(from);
+				m_handles[m_owners[from]].slot = to;
+				m_owners[to] = m_owners[from];
+				m_owners[from] = QuadHandle::InvalidIndex;
+				--last;
+			}
+			m_extent = m_live;
+			RebuildFreeSlots();
+		}
+
+		// releases the chunks past the extent. call Defragment() first to free as many as possible
+		void ShrinkToFit() {
+			const std::size_t needed = (m_extent + Q - 1) / Q;
+			if (needed == m_chunks.size()) { return; }
+			m_chunks.resize(needed);
+			m_chunks.shrink_to_fit();
+			m_owners.resize(needed * Q);
+			RebuildFreeSlots();
+		}
+
+		// releases every quad and invalidates all handles. the chunks are kept
+		void Clear() {
+			for (Entry& entry : m_handles) {
+				if (entry.slot != QuadHandle::InvalidIndex) { ++entry.generation; }
+				entry.slot = QuadHandle::InvalidIndex;
+			}
+			m_freeHandles.clear();
+			for (std::size_t i = m_handles.size(); i > 0; --i) { m_freeHandles.push_back(static_cast<std::uint32_t>(i - 1)); }
+			for (std::size_t slot = 0; slot < m_extent; ++slot) { ResetSlot(static_cast<std::uint32_t>(slot)); }
+			std::fill(m_owners.begin(), m_owners.end(), QuadHandle::InvalidIndex);
+			m_live = 0;
+			m_extent = 0;
+			RebuildFreeSlots();
+		}
+
+		// one draw call per chunk that has quads below the extent
+		void Draw(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default) const {
+			static_assert(std::is_same_v<V, sf::Vertex>, "expand packed vertices before drawing them");
+			for (std::size_t i = 0; i < GetChunkCount(); ++i) {
+				const std::size_t count = GetChunkQuadCount(i);
+				if (count == 0) { break; }
+				target.draw(GetChunk(i), 4 * count, sf::Quads, states);
+			}
+		}
+
+		std::size_t GetChunkCount() const { return m_chunks.size(); }
+
+		const V* GetChunk(const std::size_t index) const { return m_chunks[index]->data(); }
+
+		V* GetChunk(const std::size_t index) { return m_chunks[index]->data(); }
+
+		// quads in the chunk that are below the extent, including holes
+		std::size_t GetChunkQuadCount(const std::size_t index) const {
+			const std::size_t first = index * Q;
+			return m_extent > first ? std::min(m_extent - first, Q) : 0;
+		}
+
+		std::size_t GetLiveCount() const { return m_live; }
+
+		QuadPoolStats GetStats() const {
+			QuadPoolStats stats;
+			stats.capacity = m_chunks.size() * Q;
+			stats.live = m_live;
+			stats.extent = m_extent;
+			stats.holes = m_extent - m_live;
+			stats.chunks = m_chunks.size();
+			stats.occupancy = m_extent == 0 ? 1.0f : static_cast<float>(m_live) / static_cast<float>(m_extent);
+			return stats;
+		}
+
+	private:
+
+		struct Entry {
+			std::uint32_t slot = QuadHandle::InvalidIndex;
+			std::uint32_t generation = 0;
+		};
+
+		V* GetSlot(const std::uint32_t slot) {
+			return &(*m_chunks[slot / Q])[(slot % Q) * 4];
+		}
+
+		void ResetSlot(const std::uint32_t slot) {
+			ResetVertexArray(*m_chunks[slot / Q], (slot % Q) * 4, 4);
+		}
+
+		void AddChunk() {
+			m_chunks.push_back(std::make_unique<Chunk>());
+			ResetVertexArray(*m_chunks.back(), 0, 4 * Q);
+			m_owners.resize(m_chunks.size() * Q, QuadHandle::InvalidIndex);
+			for (std::size_t slot = m_owners.size(); slot > m_owners.size() - Q; --slot) {
+				m_freeSlots.push_back(static_cast<std::uint32_t>(slot - 1));
+			}
+		}
+
+		// free slots are kept in descending order so Allocate() hands out the lowest one first
+		void RebuildFreeSlots() {
+			m_freeSlots.clear();
+			for (std::size_t slot = m_owners.size(); slot > 0; --slot) {
+				if (m_owners[slot - 1] == QuadHandle::InvalidIndex) { m_freeSlots.push_back(static_cast<std::uint32_t>(slot - 1)); }
+			}
+		}
+
+		std::vector<std::unique_ptr<Chunk>> m_chunks;
+		std::vector<Entry> m_handles;
+		std::vector<std::uint32_t> m_freeHandles;
+		std::vector<std::uint32_t> m_owners; // the handle in each slot
+		std::vector<std::uint32_t> m_freeSlots;
+		std::size_t m_live = 0;
+		std::size_t m_extent = 0;
+	};
+
+	using QuadPool = BasicQuadPool<>;
+
+}
@@ -34,6 +34,7 @@
 	-	ScaleQuad()
 	-	TransformQuad()
 	-	ShearQuad()
+	-	ApplyQuadTransform()
 
 	------------------------------------------------------------
 			GETTERS
@@ -59,9 +60,16 @@
 	-	MakeRect()
 	-	MakeQuadLine()
 
+	------------------------------------------------------------
+			SORTING
+	------------------------------------------------------------
+	-	SortQuads()
+
 */
 
+#include "Sorting.hpp"
 #include "VertexArrayUtils.hpp"
+#include <vector>
 
 namespace Arc {
 
@@ -71,20 +79,26 @@ namespace Arc {
 
 	template <class V>
 	sf::Vector2f GetQuadCenter(const V& vertices, const std::size_t id) {
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		return Lerp(vertices[idx + 0].position, vertices[idx + 2].position, 0.5f);
+		return Lerp(Traits::GetPosition(vertices[idx + 0]), Traits::GetPosition(vertices[idx + 2]), 0.5f);
 	}
 
 	template <class V>
 	sf::Vector2f GetQuadSize(const V& vertices, const std::size_t id) {
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		return { GetVectorLength(vertices[idx + 1].position - vertices[idx + 0].position), GetVectorLength(vertices[idx + 2].position - vertices[idx + 1].position) };
+		const sf::Vector2f p0 = Traits::GetPosition(vertices[idx + 0]);
+		const sf::Vector2f p1 = Traits::GetPosition(vertices[idx + 1]);
+		const sf::Vector2f p2 = Traits::GetPosition(vertices[idx + 2]);
+		return { GetVectorLength(p1 - p0), GetVectorLength(p2 - p1) };
 	}
 
 	template <class V>
 	float GetQuadRotation(const V& vertices, const std::size_t id) {
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		return GetVectorAngle(vertices[idx + 1].position - vertices[idx + 0].position);
+		return GetVectorAngle(Traits::GetPosition(vertices[idx + 1]) - Traits::GetPosition(vertices[idx + 0]));
 	}
 
 	template <class V>
@@ -98,11 +112,13 @@ namespace Arc {
 
 	template <class V>
 	void MoveQuad(V& vertices, const std::size_t id, const sf::Vector2f& translation) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		MoveVertexArray(vertices, id * 4, 4, translation);
 	}
 
 	template <class V>
 	void RotateQuad(V& vertices, const std::size_t id, const float angle, const sf::Vector2f& center) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		RotateVertexArray(vertices, id * 4, 4, angle, center);
 	}
 
@@ -113,6 +129,7 @@ namespace Arc {
 
 	template <class V>
 	void ScaleQuad(V& vertices, const std::size_t id, const sf::Vector2f& scaleFactor, const sf::Vector2f& center) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		ScaleVertexArray(vertices, id * 4, 4, scaleFactor, center);
 	}
 
@@ -123,45 +140,59 @@ namespace Arc {
 
 	template <class V>
 	void TransformQuad(V& vertices, const std::size_t id, const sf::Vector2f& translation, const float angle, const sf::Vector2f& scaleFactor, const sf::Vector2f& center) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		TransformVertexArray(vertices, id * 4, 4, translation, angle, scaleFactor, center);
 	}
 
 	template <class V>
 	void TransformQuad(V& vertices, const std::size_t id, const sf::Vector2f& translation, const float angle, const sf::Vector2f& scaleFactor) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		TransformVertexArray(vertices, id * 4, 4, translation, angle, scaleFactor, GetQuadCenter(vertices, id));
 	}
 
 	template <class V>
-	void ShearQuad(V& vertices, const std::size_t id, const sf::Vector2f& shearFactor, const sf::Vector2f& center = {}) {
+	void ShearQuad(V& vertices, const std::size_t id, const sf::Vector2f& shearFactor, const sf::Vector2f& center) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		ShearVertexArray(vertices, id * 4, 4, shearFactor, center);
 	}
 
 	template <class V>
 	void ShearQuad(V& vertices, const std::size_t id, const sf::Vector2f& shearFactor) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		ShearVertexArray(vertices, id * 4, 4, shearFactor, GetQuadCenter(vertices, id));
 	}
 
+	template <class V>
+	void ApplyQuadTransform(V& vertices, const std::size_t id, const Affine2& transform) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
+		ApplyTransform(vertices, id * 4, 4, transform);
+	}
+
 	//////////////////////////////////////////////////////////////////////
 	//	SETTERS
 	//////////////////////////////////////////////////////////////////////
 
 	template <class V>
 	void SetQuadPosition(V& vertices, const std::size_t id, const sf::Vector2f& position) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		SetVertexArrayPosition(vertices, id * 4, 4, position, GetQuadCenter(vertices, id));
 	}
 
 	template <class V>
 	void SetQuadColor(V& vertices, const std::size_t id, const sf::Color& color) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
 		SetVertexArrayColor(vertices, id * 4, 4, color);
 	}
 
 	template <class V>
 	void SetQuadTextureRect(V& vertices, const std::size_t id, const sf::FloatRect& textureRect) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		vertices[idx + 0].texCoords = { textureRect.left, textureRect.top };
-		vertices[idx + 1].texCoords = { textureRect.left + textureRect.width, textureRect.top };
-		vertices[idx + 2].texCoords = { textureRect.left + textureRect.width, textureRect.top + textureRect.height };
-		vertices[idx + 3].texCoords = { textureRect.left, textureRect.top + textureRect.height };
+		Traits::SetTexCoords(vertices[idx + 0], { textureRect.left, textureRect.top });
+		Traits::SetTexCoords(vertices[idx + 1], { textureRect.left + textureRect.width, textureRect.top });
+		Traits::SetTexCoords(vertices[idx + 2], { textureRect.left + textureRect.width, textureRect.top + textureRect.height });
+		Traits::SetTexCoords(vertices[idx + 3], { textureRect.left, textureRect.top + textureRect.height });
 	}
 
 	//////////////////////////////////////////////////////////////////////
@@ -170,29 +201,35 @@ namespace Arc {
 
 	template <class V>
 	void MakeRect(V& vertices, const std::size_t id, const sf::FloatRect& rect) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		vertices[idx + 0].position = { rect.left, rect.top };
-		vertices[idx + 1].position = { rect.left + rect.width, rect.top };
-		vertices[idx + 2].position = { rect.left + rect.width, rect.top + rect.height};
-		vertices[idx + 3].position = { rect.left, rect.top + rect.height};
+		Traits::SetPosition(vertices[idx + 0], { rect.left, rect.top });
+		Traits::SetPosition(vertices[idx + 1], { rect.left + rect.width, rect.top });
+		Traits::SetPosition(vertices[idx + 2], { rect.left + rect.width, rect.top + rect.height });
+		Traits::SetPosition(vertices[idx + 3], { rect.left, rect.top + rect.height });
 	}
 	
 	template <class V>
 	void MakeQuad(V& vertices, const std::size_t id, const sf::Vector2f& center, const sf::Vector2f& size) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		vertices[idx + 0].position = { -0.5f * size.x + center.x, -0.5f * size.y + center.y };
-		vertices[idx + 1].position = {  0.5f * size.x + center.x, -0.5f * size.y + center.y };
-		vertices[idx + 2].position = {  0.5f * size.x + center.x,  0.5f * size.y + center.y };
-		vertices[idx + 3].position = { -0.5f * size.x + center.x,  0.5f * size.y + center.y };
+		Traits::SetPosition(vertices[idx + 0], { -0.5f * size.x + center.x, -0.5f * size.y + center.y });
+		Traits::SetPosition(vertices[idx + 1], {  0.5f * size.x + center.x, -0.5f * size.y + center.y });
+		Traits::SetPosition(vertices[idx + 2], {  0.5f * size.x + center.x,  0.5f * size.y + center.y });
+		Traits::SetPosition(vertices[idx + 3], { -0.5f * size.x + center.x,  0.5f * size.y + center.y });
 	}
 
 	template <class V>
 	void MakeDiamond(V& vertices, const std::size_t id, const float width, const float height, const sf::Vector2f& center) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4);
+		using Traits = VertexTraitsOf<V>;
 		const std::size_t idx = id * 4;
-		vertices[idx + 0].position = { 0.0f, -0.5f * height };
-		vertices[idx + 1].position = { 0.5f * width, 0.0f };
-		vertices[idx + 2].position = { 0.0f, 0.5f * height };
-		vertices[idx + 3].position = { -0.5f * width, 0.0f };
+		Traits::SetPosition(vertices[idx + 0], { 0.0f, -0.5f * height });
+		Traits::SetPosition(vertices[idx + 1], { 0.5f * width, 0.0f });
+		Traits::SetPosition(vertices[idx + 2], { 0.0f, 0.5f * height });
+		Traits::SetPosition(vertices[idx + 3], { -0.5f * width, 0.0f });
 	}
 
 	template <class V>
@@ -217,4 +254,52 @@ namespace Arc {
 		MoveQuad(vertices, id, start);
 	}
 
+	//////////////////////////////////////////////////////////////////////
+	//	SORTING
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - sorts the count quads starting at firstId by keys[0 .. count) in ascending order.
+	//   quads with equal keys keep their order. use GetSortableKey() for float keys like depths
+	// - the keys are radix sorted into a permutation first and then whole quads are gathered
+	//   into vertexScratch in one pass and copied back, so each quad is moved twice no matter
+	//   how far out of order it was
+	// - afterwards permutation[i] is the old position (relative to firstId) of the quad now at i.
+	//   ApplyPermutation() reorders arrays that run parallel to the quads the same way
+	// - keeping the three vectors around between calls means sorting does not allocate
+	template <class V, typename K>
+	void SortQuads(V& vertices, const std::size_t firstId, const std::size_t count, const K* keys, std::vector<std::uint32_t>& permutation, std::vector<std::uint32_t>& scratch, std::vector<VertexTypeOf<V>>& vertexScratch) {
+		RadixSortIndices(keys, count, permutation, scratch);
+		std::size_t unsorted = 0;
+		while (unsorted < count && permutation[unsorted] == unsorted) { ++unsorted; }
+		if (unsorted == count) { return; }
+
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4 * count);
+		vertexScratch.resize(4 * count);
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			sf::Vertex* quads = MakeVertexSpan(vertices, firstId * 4, count * 4).data();
+			for (std::size_t i = 0; i < count; ++i) {
+				std::copy_n(quads + permutation[i] * 4, 4, vertexScratch.data() + i * 4);
+			}
+			std::copy(vertexScratch.begin(), vertexScratch.end(), quads);
+		}
+		else {
+			const std::size_t first = firstId * 4;
+			for (std::size_t i = 0; i < count; ++i) {
+				const std::size_t from = first + permutation[i] * 4;
+				for (std::size_t j = 0; j < 4; ++j) { vertexScratch[i * 4 + j] = vertices[from + j]; }
+			}
+			for (std::size_t i = 0; i < 4 * count; ++i) { vertices[first + i] = vertexScratch[i]; }
+		}
+	}
+
+	template <class V, typename K>
+	std::vector<std::uint32_t> SortQuads(V& vertices, const std::size_t firstId, const std::size_t count, const K* keys) {
+		std::vector<std::uint32_t> permutation;
+		std::vector<std::uint32_t> scratch;
+		std::vector<VertexTypeOf<V>> vertexScratch;
+		SortQuads(vertices, firstId, count, keys, permutation, scratch, vertexScratch);
+		return permutation;
+	}
+
 }
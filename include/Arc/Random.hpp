@@ -58,6 +58,7 @@
 */
 
 #include "Mathematics.hpp"
+#include "Profiling.hpp"
 #include <SFML/Graphics/Rect.hpp>
 #include <random>
 
@@ -85,8 +86,9 @@ namespace Arc {
 
 		template <typename T>
 		T UniformDistribution(const T minVal, const T maxVal) {
+			ARC_PROFILE_COUNT(ProfileCounter::RandomDraws, 1);
 			if constexpr (std::is_same_v<T, sf::Uint8> || std::is_same_v<T, sf::Int8>) {
-				return static_cast<T>(Uniform(static_cast<int>(minVal), static_cast<int>(maxVal)));
+				return static_cast<T>(STLRand<std::uniform_int_distribution<int>>(m_rng, static_cast<int>(minVal), static_cast<int>(maxVal)));
 			}
 			else if constexpr (std::is_integral_v<T>) {
 				return STLRand<std::uniform_int_distribution<T>>(m_rng, minVal, maxVal);
@@ -98,6 +100,7 @@ namespace Arc {
 
 		template <typename T>
 		T NormalDistribution(const T mean, const T stddev) {
+			ARC_PROFILE_COUNT(ProfileCounter::RandomDraws, 1);
 			return STLRand<std::normal_distribution<T>>(m_rng, mean, stddev);
 		}
 
@@ -108,7 +111,7 @@ namespace Arc {
 		template <typename T>
 		sf::Vector2<T> PointInLine(const sf::Vector2<T>& a, const sf::Vector2<T>& b) {
 			if constexpr (std::is_integral_v<T>) { return Lerp(a, b, UniformDistribution<float>(0.0f, 1.0f)); }
-			else if constexpr (std::is_floating_point_v<T>) { Lerp(a, b, UniformDistribution<T>(0.0, 1.0)); }
+			else if constexpr (std::is_floating_point_v<T>) { return Lerp(a, b, UniformDistribution<T>(0.0, 1.0)); }
 		}
 
 		template <typename T>
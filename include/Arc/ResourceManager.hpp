@@ -34,6 +34,8 @@
 	-	GetFile()
 	-	ClearFiles()
 	-	LoadResource()
+	-	InsertResource()
+	-	HasResource()
 	-	RemoveResource()
 	-	GetResource()
 	-	ClearResources()
@@ -68,6 +70,7 @@
 
 */
 
+#include "Profiling.hpp"
 #include <SFML/Audio/Music.hpp>
 #include <SFML/System/String.hpp>
 #include <unordered_map>
@@ -99,9 +102,14 @@ namespace Arc {
 		template <typename ...A>
 		R* LoadResource(const I& id, A&& ...args) {
 			auto itr_res = m_resources.find(id);
-			if (itr_res != m_resources.end()) { return &itr_res->second; } // the resource already exists
+			if (itr_res != m_resources.end()) { // the resource already exists
+				ARC_PROFILE_COUNT(ProfileCounter::ResourceHits, 1);
+				return &itr_res->second;
+			}
+			ARC_PROFILE_COUNT(ProfileCounter::ResourceMisses, 1);
 			auto itr_file = m_files.find(id);
 			if (itr_file == m_files.end()) { return nullptr; } // file not found
+			ARC_PROFILE_SCOPE("ResourceManager::LoadResource");
 			R new_resource;
 			if constexpr (std::is_same_v<R, sf::Music>) {
 				if (!new_resource.openFromFile(itr_file->second)) { return nullptr; }
@@ -109,9 +117,19 @@ namespace Arc {
 			else {
 				if (!new_resource.loadFromFile(itr_file->second, std::forward<A>(args)...)) { return nullptr; }
 			}
+			ARC_PROFILE_COUNT(ProfileCounter::ResourceLoads, 1);
 			return m_resources.try_emplace(id, std::move(new_resource)).second ? &m_resources.at(id) : nullptr;
 		}
 
+		// adds an already loaded resource. returns nullptr if the id is already taken
+		R* InsertResource(const I& id, R&& resource) {
+			return m_resources.try_emplace(id, std::move(resource)).second ? &m_resources.at(id) : nullptr;
+		}
+
+		bool HasResource(const I& id) const {
+			return m_resources.find(id) != m_resources.end();
+		}
+
 		void RemoveResource(const I& id) {
 			m_resources.erase(id);
 		}
@@ -0,0 +1,188 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			POISSON DISK
+	------------------------------------------------------------
+	-	GetPoissonDiskRadius()
+	-	PoissonDiskSampling()
+	-	VariablePoissonDiskSampling()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::RNG rng;
+		rng.Seed(1234); // the same seed always gives the same points
+
+		// scatter points at least 24 pixels apart over a 10x10 grid of 32x32 tiles
+		std::vector<sf::Vector2f> points;
+		Arc::PoissonDiskSampling(points, rng, { 0.0f, 0.0f, 320.0f, 320.0f }, 24.0f);
+
+		// points get closer together wherever the density function returns values closer to 1
+		Arc::VariablePoissonDiskSampling(points, rng, { 0.0f, 0.0f, 320.0f, 320.0f }, 8.0f, 32.0f, [](const sf::Vector2f& p) { return p.x / 320.0f; });
+
+	}
+
+*/
+
+#include "Random.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	POISSON DISK
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - the sampler below ends up with about 0.62 / radius^2 points per unit area
+	//   so this gives the radius that fills the rect with roughly count points
+	inline float GetPoissonDiskRadius(const sf::FloatRect& bounds, const std::size_t count) {
+		if (count == 0) { return std::max(bounds.width, bounds.height); }
+		return std::sqrt(0.62f * bounds.width * bounds.height / static_cast<float>(count));
+	}
+
+	// NOTE:
+	// - this is bridson's algorithm. the background grid has cells small enough
+	//   to hold at most one point so each candidate only checks a few cells
+	//   which keeps the whole thing O(n)
+	// - radiusAt(point) must return a value between minRadius and maxRadius
+	// - if tileable is true the points wrap around the edges of the bounds so
+	//   the same set can be repeated across an infinite map without seams
+	template <class G, class R>
+	std::size_t PoissonDiskSampling(std::vector<sf::Vector2f>& points, RandomGenerator<G>& rng, const sf::FloatRect& bounds, const float minRadius, const float maxRadius, R&& radiusAt, const bool tileable = false, const std::size_t maxPoints = std::numeric_limits<std::size_t>::max(), const unsigned int attempts = 30) {
+		const std::size_t first = points.size();
+		if (bounds.width <= 0.0f || bounds.height <= 0.0f || minRadius <= 0.0f || maxPoints == 0) { return 0; }
+
+		const float maxCellSize = minRadius / std::sqrt(2.0f);
+		const int gridWidth = std::max(1, static_cast<int>(std::ceil(bounds.width / maxCellSize)));
+		const int gridHeight = std::max(1, static_cast<int>(std::ceil(bounds.height / maxCellSize)));
+		const sf::Vector2f cellSize = { bounds.width / static_cast<float>(gridWidth), bounds.height / static_cast<float>(gridHeight) };
+		const int reach = static_cast<int>(std::ceil(maxRadius / std::min(cellSize.x, cellSize.y)));
+
+		std::vector<std::int32_t> grid(static_cast<std::size_t>(gridWidth) * static_cast<std::size_t>(gridHeight), -1);
+		std::vector<float> radii;
+		std::vector<std::int32_t> active;
+
+		auto cellOf = [&](const sf::Vector2f& p) -> sf::Vector2i {
+			return {
+				std::min(gridWidth - 1, static_cast<int>((p.x - bounds.left) / cellSize.x)),
+				std::min(gridHeight - 1, static_cast<int>((p.y - bounds.top) / cellSize.y))
+			};
+		};
+
+		auto fits = [&](const sf::Vector2f& p, const float radius) {
+			const sf::Vector2i cell = cellOf(p);
+			for (int dy = -reach; dy <= reach; ++dy) {
+				int y = cell.y + dy;
+				if (tileable) { y = (y % gridHeight + gridHeight) % gridHeight; }
+				else if (y < 0 || y >= gridHeight) { continue; }
+				for (int dx = -reach; dx <= reach; ++dx) {
+					int x = cell.x + dx;
+					if (tileable) { x = (x % gridWidth + gridWidth) % gridWidth; }
+					else if (x < 0 || x >= gridWidth) { continue; }
+					const std::int32_t other = grid[static_cast<std::size_t>(y) * gridWidth + x];
+					if (other < 0) { continue; }
+					sf::Vector2f d = points[first + other] - p;
+					if (tileable) {
+						d.x = std::abs(d.x);
+						d.y = std::abs(d.y);
+						d.x = std::min(d.x, bounds.width - d.x);
+						d.y = std::min(d.y, bounds.height - d.y);
+					}
+					const float r = std::max(radius, radii[other]);
+					if (d.x * d.x + d.y * d.y < r * r) { return false; }
+				}
+			}
+			return true;
+		};
+
+		auto insert = [&](const sf::Vector2f& p, const float radius) {
+			const sf::Vector2i cell = cellOf(p);
+			const std::int32_t id = static_cast<std::int32_t>(radii.size());
+			grid[static_cast<std::size_t>(cell.y) * gridWidth + cell.x] = id;
+			points.push_back(p);
+			radii.push_back(radius);
+			active.push_back(id);
+		};
+
+		const sf::Vector2f seed = rng.PointInRect(bounds);
+		insert(seed, std::clamp(radiusAt(seed), minRadius, maxRadius));
+
+		while (!active.empty() && radii.size() < maxPoints) {
+			const std::size_t slot = rng.UniformDistribution(std::size_t{ 0 }, active.size() - 1);
+			const std::int32_t parent = active[slot];
+			const sf::Vector2f origin = points[first + parent];
+			const float parentRadius = radii[parent];
+			bool found = false;
+			for (unsigned int i = 0; i < attempts; ++i) {
+				// uniform by area over the annulus [r, 2r] around the parent
+				const float dist = std::sqrt(rng.UniformDistribution(parentRadius * parentRadius, 4.0f * parentRadius * parentRadius));
+				sf::Vector2f p = origin + dist * UnitVector(rng.UniformDistribution(0.0f, 360.0f));
+				if (tileable) {
+					p.x = bounds.left + std::fmod(std::fmod(p.x - bounds.left, bounds.width) + bounds.width, bounds.width);
+					p.y = bounds.top + std::fmod(std::fmod(p.y - bounds.top, bounds.height) + bounds.height, bounds.height);
+				}
+				else if (!bounds.contains(p)) {
+					continue;
+				}
+				const float radius = std::clamp(radiusAt(p), minRadius, maxRadius);
+				if (fits(p, radius)) {
+					insert(p, radius);
+					found = true;
+					break;
+				}
+			}
+			if (!found) {
+				active[slot] = active.back();
+				active.pop_back();
+			}
+		}
+		return points.size() - first;
+	}
+
+	template <class G>
+	std::size_t PoissonDiskSampling(std::vector<sf::Vector2f>& points, RandomGenerator<G>& rng, const sf::FloatRect& bounds, const float radius, const bool tileable = false, const std::size_t maxPoints = std::numeric_limits<std::size_t>::max(), const unsigned int attempts = 30) {
+		return PoissonDiskSampling(points, rng, bounds, radius, radius, [radius](const sf::Vector2f&) { return radius; }, tileable, maxPoints, attempts);
+	}
+
+	// NOTE:
+	// - density(point) should return a value between 0 and 1 where 0 spaces
+	//   points maxRadius apart and 1 spaces them minRadius apart
+	template <class G, class D>
+	std::size_t VariablePoissonDiskSampling(std::vector<sf::Vector2f>& points, RandomGenerator<G>& rng, const sf::FloatRect& bounds, const float minRadius, const float maxRadius, D&& density, const bool tileable = false, const std::size_t maxPoints = std::numeric_limits<std::size_t>::max(), const unsigned int attempts = 30) {
+		return PoissonDiskSampling(points, rng, bounds, minRadius, maxRadius, [&](const sf::Vector2f& p) { return Lerp(maxRadius, minRadius, std::clamp(density(p), 0.0f, 1.0f)); }, tileable, maxPoints, attempts);
+	}
+
+}
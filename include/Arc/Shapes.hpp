@@ -0,0 +1,240 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			LEVEL OF DETAIL
+	------------------------------------------------------------
+	-	GetCircleSegmentCount()
+	-	GetUnitCircle()
+
+	------------------------------------------------------------
+			QUAD COUNTS
+	------------------------------------------------------------
+	-	GetCircleQuadCount()
+	-	GetArcQuadCount()
+	-	GetRoundedRectQuadCount()
+	-	GetConvexPolygonQuadCount()
+
+	------------------------------------------------------------
+			MAKERS
+	------------------------------------------------------------
+	-	MakeCircle()
+	-	MakeEllipse()
+	-	MakeArc()
+	-	MakeRoundedRect()
+	-	MakeConvexPolygon()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		// enough segments for a 40 pixel circle to look round on screen
+		const std::size_t segments = Arc::GetCircleSegmentCount(40.0f);
+		const std::size_t quads = Arc::GetCircleQuadCount(segments);
+
+		// 1000 circles in one vertex array which is one draw call
+		sf::VertexArray vertices(sf::Quads, 4 * quads * 1000);
+		for (std::size_t i = 0; i < 1000; ++i) {
+			Arc::MakeCircle(vertices, i * quads, { 20.0f * (i % 40), 20.0f * (i / 40) }, 40.0f, segments);
+		}
+
+	}
+
+*/
+
+#include "QuadUtils.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	LEVEL OF DETAIL
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - the smallest even number of segments where the edges of the circle are no
+	//   further than tolerance from the real circle. with the radius in pixels on
+	//   screen (after zoom) the tolerance is in pixels
+	inline std::size_t GetCircleSegmentCount(const float radius, const float tolerance = 0.25f, const std::size_t minSegments = 8, const std::size_t maxSegments = 256) {
+		std::size_t segments = maxSegments;
+		if (radius <= tolerance) {
+			segments = minSegments;
+		}
+		else {
+			const float n = Pi_v<float> / std::acos(1.0f - tolerance / radius);
+			if (n < static_cast<float>(maxSegments)) { segments = static_cast<std::size_t>(std::ceil(n)); }
+		}
+		segments = std::clamp(segments, minSegments, maxSegments);
+		return std::max(std::size_t{ 4 }, segments + (segments % 2));
+	}
+
+	// NOTE:
+	// - segments + 1 points on the unit circle starting at angle 0 (the last point
+	//   is the same as the first). each segment count is only ever computed once per thread
+	inline const std::vector<sf::Vector2f>& GetUnitCircle(const std::size_t segments) {
+		thread_local std::unordered_map<std::size_t, std::vector<sf::Vector2f>> cache;
+		std::vector<sf::Vector2f>& points = cache[segments];
+		if (points.empty()) {
+			points.resize(segments + 1);
+			for (std::size_t i = 0; i < segments; ++i) {
+				const float theta = 2.0f * Pi_v<float> * static_cast<float>(i) / static_cast<float>(segments);
+				points[i] = { std::cos(theta), std::sin(theta) };
+			}
+			points[segments] = points[0];
+		}
+		return points;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	QUAD COUNTS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - circles, ellipses and polygons are fans where each quad covers two edges
+	//   (the center and three points on the edge) so they batch with other sf::Quads
+	inline std::size_t GetCircleQuadCount(const std::size_t segments) {
+		return std::max(std::size_t{ 4 }, segments + (segments % 2)) / 2;
+	}
+
+	inline std::size_t GetArcQuadCount(const std::size_t segments) {
+		return segments;
+	}
+
+	inline std::size_t GetRoundedRectQuadCount(const std::size_t cornerSegments) {
+		return 3 + 4 * (std::max(std::size_t{ 2 }, cornerSegments + (cornerSegments % 2)) / 2);
+	}
+
+	inline std::size_t GetConvexPolygonQuadCount(const std::size_t pointCount) {
+		return pointCount < 3 ? 0 : (pointCount - 1) / 2;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	MAKERS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - writes GetCircleQuadCount(segments) quads starting at quad id
+	// - segments should be even (Arc::GetCircleSegmentCount() always is). an odd
+	//   count is rounded up
+	template <class V>
+	void MakeEllipse(V& vertices, const std::size_t id, const sf::Vector2f& center, const sf::Vector2f& radii, const std::size_t segments) {
+		const std::size_t n = std::max(std::size_t{ 4 }, segments + (segments % 2));
+		const std::vector<sf::Vector2f>& unit = GetUnitCircle(n);
+		std::size_t idx = id * 4;
+		for (std::size_t i = 0; i < n; i += 2) {
+			vertices[idx + 0].position = center;
+			vertices[idx + 1].position = { center.x + radii.x * unit[i + 0].x, center.y + radii.y * unit[i + 0].y };
+			vertices[idx + 2].position = { center.x + radii.x * unit[i + 1].x, center.y + radii.y * unit[i + 1].y };
+			vertices[idx + 3].position = { center.x + radii.x * unit[i + 2].x, center.y + radii.y * unit[i + 2].y };
+			idx += 4;
+		}
+	}
+
+	template <class V>
+	void MakeCircle(V& vertices, const std::size_t id, const sf::Vector2f& center, const float radius, const std::size_t segments) {
+		MakeEllipse(vertices, id, center, { radius, radius }, segments);
+	}
+
+	// NOTE:
+	// - a ring between innerRadius and outerRadius from startAngle to startAngle + sweep
+	//   (in degrees). an innerRadius of 0 gives a pie slice
+	// - writes GetArcQuadCount(segments) quads starting at quad id
+	template <class V>
+	void MakeArc(V& vertices, const std::size_t id, const sf::Vector2f& center, const float innerRadius, const float outerRadius, const float startAngle, const float sweep, const std::size_t segments) {
+		const std::size_t n = std::max(std::size_t{ 1 }, segments);
+		// one rotation per step is applied by complex multiplication so the
+		// whole arc only needs two sin/cos pairs
+		const sf::Vector2f step = UnitVector(sweep / static_cast<float>(n));
+		sf::Vector2f dir = UnitVector(startAngle);
+		std::size_t idx = id * 4;
+		for (std::size_t i = 0; i < n; ++i) {
+			const sf::Vector2f next = { dir.x * step.x - dir.y * step.y, dir.x * step.y + dir.y * step.x };
+			vertices[idx + 0].position = center + innerRadius * dir;
+			vertices[idx + 1].position = center + outerRadius * dir;
+			vertices[idx + 2].position = center + outerRadius * next;
+			vertices[idx + 3].position = center + innerRadius * next;
+			dir = next;
+			idx += 4;
+		}
+	}
+
+	// NOTE:
+	// - three quads for the body and a quarter circle fan for each corner
+	// - writes GetRoundedRectQuadCount(cornerSegments) quads starting at quad id
+	template <class V>
+	void MakeRoundedRect(V& vertices, const std::size_t id, const sf::FloatRect& rect, const float cornerRadius, const std::size_t cornerSegments) {
+		const float r = std::clamp(cornerRadius, 0.0f, 0.5f * std::min(rect.width, rect.height));
+		const std::size_t cs = std::max(std::size_t{ 2 }, cornerSegments + (cornerSegments % 2));
+		MakeRect(vertices, id + 0, { rect.left + r, rect.top, rect.width - 2.0f * r, rect.height });
+		MakeRect(vertices, id + 1, { rect.left, rect.top + r, r, rect.height - 2.0f * r });
+		MakeRect(vertices, id + 2, { rect.left + rect.width - r, rect.top + r, r, rect.height - 2.0f * r });
+		// starting from angle 0 the quarters of the unit circle are the
+		// bottom right, bottom left, top left and top right corners
+		const sf::Vector2f centers[4] = {
+			{ rect.left + rect.width - r, rect.top + rect.height - r },
+			{ rect.left + r, rect.top + rect.height - r },
+			{ rect.left + r, rect.top + r },
+			{ rect.left + rect.width - r, rect.top + r }
+		};
+		const std::vector<sf::Vector2f>& unit = GetUnitCircle(4 * cs);
+		std::size_t idx = (id + 3) * 4;
+		for (std::size_t corner = 0; corner < 4; ++corner) {
+			const sf::Vector2f& c = centers[corner];
+			for (std::size_t i = corner * cs; i < (corner + 1) * cs; i += 2) {
+				vertices[idx + 0].position = c;
+				vertices[idx + 1].position = c + r * unit[i + 0];
+				vertices[idx + 2].position = c + r * unit[i + 1];
+				vertices[idx + 3].position = c + r * unit[i + 2];
+				idx += 4;
+			}
+		}
+	}
+
+	// NOTE:
+	// - the points must be in order around a convex polygon
+	// - writes GetConvexPolygonQuadCount(pointCount) quads starting at quad id. with
+	//   an odd number of edges left over the last quad repeats its last point
+	template <class V>
+	void MakeConvexPolygon(V& vertices, const std::size_t id, const sf::Vector2f* points, const std::size_t pointCount) {
+		if (pointCount < 3) { return; }
+		std::size_t idx = id * 4;
+		for (std::size_t i = 1; i + 1 < pointCount; i += 2) {
+			vertices[idx + 0].position = points[0];
+			vertices[idx + 1].position = points[i];
+			vertices[idx + 2].position = points[i + 1];
+			vertices[idx + 3].position = points[std::min(i + 2, pointCount - 1)];
+			idx += 4;
+		}
+	}
+
+}
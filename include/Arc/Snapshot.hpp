@@ -0,0 +1,505 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			COMPRESSION
+	------------------------------------------------------------
+	-	CompressLZ()
+	-	DecompressLZ()
+
+	------------------------------------------------------------
+			SNAPSHOT WRITER MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	AddSection()
+	-	AddArray()
+	-	AddValue()
+	-	AddVertices()
+	-	AddGenerator()
+	-	SaveToMemory()
+	-	SaveToFile()
+	-	Clear()
+
+	------------------------------------------------------------
+			SNAPSHOT READER MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	LoadFromFile()
+	-	LoadFromMemory()
+	-	HasSection()
+	-	GetSectionData()
+	-	GetSectionSize()
+	-	GetArray()
+	-	ReadArray()
+	-	ReadValue()
+	-	ReadVertices()
+	-	ReadGenerator()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		// particles stored as arrays of structures of arrays
+		std::vector<sf::Vector2f> velocities;
+		std::vector<float> lifetimes;
+		std::size_t cursor = 0;
+		Arc::RNG rng;
+
+		Arc::SnapshotWriter writer;
+		writer.AddVertices("particles", vertices, 0, vertices.getVertexCount(), true); // compressed
+		writer.AddArray("velocities", velocities);
+		writer.AddArray("lifetimes", lifetimes);
+		writer.AddValue("cursor", cursor);
+		writer.AddGenerator("rng", rng.GetGenerator());
+		writer.SaveToFile("checkpoint.arcs");
+
+		Arc::SnapshotReader reader;
+		if (reader.LoadFromFile("checkpoint.arcs")) {
+			reader.ReadVertices("particles", vertices, 0); // one memory copy
+			reader.ReadArray("velocities", velocities);
+			reader.ReadArray("lifetimes", lifetimes);
+			reader.ReadValue("cursor", cursor);
+			reader.ReadGenerator("rng", rng.GetGenerator());
+		}
+
+	}
+
+*/
+
+#include "VertexArrayUtils.hpp"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	COMPRESSION
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - a byte oriented LZ77 codec in the style of LZ4. each sequence is a token byte holding
+	//   the literal count and match length, the literals, a 16 bit offset and the match length.
+	//   lengths of 15 or more continue in following bytes. the last sequence only has literals
+	// - matches are found through a hash table of the last position of every 4 byte sequence,
+	//   so compressing is a single pass and decompressing is mostly memcpy
+	inline void CompressLZ(const unsigned char* src, const std::size_t size, std::vector<unsigned char>& out) {
+		constexpr std::size_t MinMatch = 4;
+		constexpr std::size_t MaxOffset = 65535;
+		constexpr unsigned int HashBits = 14;
+		constexpr std::size_t None = static_cast<std::size_t>(-1);
+		out.clear();
+		out.reserve(size + size / 255 + 16);
+		std::vector<std::size_t> table(std::size_t(1) << HashBits, None);
+
+		auto writeLength = [&out](std::size_t length) {
+			while (length >= 255) {
+				out.push_back(255);
+				length -= 255;
+			}
+			out.push_back(static_cast<unsigned char>(length));
+		};
+		auto writeLiterals = [&](const std::size_t start, const std::size_t count, const unsigned int matchNibble) {
+			out.push_back(static_cast<unsigned char>((std::min<std::size_t>(count, 15) << 4) | matchNibble));
+			if (count >= 15) { writeLength(count - 15); }
+			out.insert(out.end(), src + start, src + start + count);
+		};
+
+		std::size_t anchor = 0;
+		std::size_t pos = 0;
+		while (pos + MinMatch <= size) {
+			std::uint32_t sequence;
+			std::memcpy(&sequence, src + pos, sizeof(sequence));
+			const std::size_t hash = (sequence * 2654435761u) >> (32 - HashBits);
+			const std::size_t candidate = table[hash];
+			table[hash] = pos;
+			if (candidate == None || pos - candidate > MaxOffset || std::memcmp(src + candidate, src + pos, MinMatch) != 0) {
+				++pos;
+				continue;
+			}
+			std::size_t length = MinMatch;
+			while (pos + length < size && src[candidate + length] == src[pos + length]) { ++length; }
+			const std::size_t offset = pos - candidate;
+			writeLiterals(anchor, pos - anchor, static_cast<unsigned int>(std::min<std::size_t>(length - MinMatch, 15)));
+			out.push_back(static_cast<unsigned char>(offset & 0xFF));
+			out.push_back(static_cast<unsigned char>(offset >> 8));
+			if (length - MinMatch >= 15) { writeLength(length - MinMatch - 15); }
+			pos += length;
+			anchor = pos;
+		}
+		writeLiterals(anchor, size - anchor, 0);
+	}
+
+	// returns false if the data is corrupt or does not decompress to exactly size bytes
+	inline bool DecompressLZ(const unsigned char* src, const std::size_t srcSize, unsigned char* dst, const std::size_t size) {
+		std::size_t in = 0;
+		std::size_t out = 0;
+		auto readLength = [&](std::size_t& length) {
+			unsigned char byte = 255;
+			while (byte == 255) {
+				if (in >= srcSize) { return false; }
+				byte = src[in++];
+				length += byte;
+			}
+			return true;
+		};
+		while (in < srcSize) {
+			const unsigned int token = src[in++];
+			std::size_t literals = token >> 4;
+			if (literals == 15 && !readLength(literals)) { return false; }
+			if (literals > srcSize - in || literals > size - out) { return false; }
+			std::memcpy(dst + out, src + in, literals);
+			in += literals;
+			out += literals;
+			if (in == srcSize) { break; }
+
+			if (srcSize - in < 2) { return false; }
+			const std::size_t offset = static_cast<std::size_t>(src[in]) | (static_cast<std::size_t>(src[in + 1]) << 8);
+			in += 2;
+			std::size_t length = token & 15;
+			if (length == 15 && !readLength(length)) { return false; }
+			length += 4;
+			if (offset == 0 || offset > out || length > size - out) { return false; }
+			if (offset >= length) {
+				std::memcpy(dst + out, dst + out - offset, length);
+			}
+			else {
+				// the match overlaps the bytes it is writing, which repeats the last offset bytes
+				for (std::size_t i = 0; i < length; ++i) { dst[out + i] = dst[out - offset + i]; }
+			}
+			out += length;
+		}
+		return out == size;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	SNAPSHOTS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - the file starts with a SnapshotHeader followed by one SnapshotSectionEntry per section.
+	//   section data starts on SnapshotAlignment byte boundaries so uncompressed sections can be
+	//   used in place from a memory mapped file
+	// - values are stored in the native byte order and layout. a snapshot is meant to be read by
+	//   the same build that wrote it, the header rejects other byte orders and versions
+	constexpr std::uint32_t SnapshotVersion = 1;
+	constexpr std::size_t SnapshotAlignment = 64;
+
+	struct SnapshotHeader {
+		char magic[4] = { 'A', 'R', 'C', 'S' };
+		std::uint32_t byteOrder = 0x01020304;
+		std::uint32_t version = SnapshotVersion;
+		std::uint32_t sectionCount = 0;
+	};
+
+	struct SnapshotSectionEntry {
+		char name[32] = {};
+		std::uint64_t offset = 0; // from the start of the snapshot
+		std::uint64_t storedSize = 0; // in the file, after compression
+		std::uint64_t size = 0; // after decompression
+		std::uint32_t elementSize = 1; // checked against the type the section is read as
+		std::uint32_t compressed = 0;
+	};
+
+	static_assert(sizeof(SnapshotHeader) == 16 && sizeof(SnapshotSectionEntry) == 64, "snapshot structures must not be padded");
+
+	class SnapshotWriter {
+	public:
+
+		SnapshotWriter() = default;
+
+		// NOTE:
+		// - names are at most 31 characters. compressed sections that do not get smaller are stored as is
+		void AddSection(const std::string& name, const void* data, const std::size_t size, const std::size_t elementSize = 1, const bool compress = false) {
+			Section section;
+			std::strncpy(section.entry.name, name.c_str(), sizeof(section.entry.name) - 1);
+			section.entry.size = size;
+			section.entry.elementSize = static_cast<std::uint32_t>(elementSize);
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			if (compress && size > 0) {
+				CompressLZ(bytes, size, section.bytes);
+				section.entry.compressed = section.bytes.size() < size ? 1 : 0;
+			}
+			if (!section.entry.compressed) { section.bytes.assign(bytes, bytes + size); }
+			section.entry.storedSize = section.bytes.size();
+			m_sections.push_back(std::move(section));
+		}
+
+		template <class T>
+		void AddArray(const std::string& name, const T* data, const std::size_t count, const bool compress = false) {
+			static_assert(std::is_trivially_copyable_v<T>, "snapshots only store trivially copyable types");
+			AddSection(name, data, count * sizeof(T), sizeof(T), compress);
+		}
+
+		template <class T>
+		void AddArray(const std::string& name, const std::vector<T>& data, const bool compress = false) {
+			AddArray(name, data.data(), data.size(), compress);
+		}
+
+		template <class T>
+		void AddValue(const std::string& name, const T& value) {
+			AddArray(name, &value, 1);
+		}
+
+		template <class V>
+		void AddVertices(const std::string& name, const V& vertices, const std::size_t start, const std::size_t count, const bool compress = false) {
+			if constexpr (IsContiguousVertexContainerV<V>) {
+				AddArray(name, MakeVertexSpan(vertices, start, count).data(), count, compress);
+			}
+			else {
+				std::vector<VertexTypeOf<V>> copy(count);
+				for (std::size_t i = 0; i < count; ++i) { copy[i] = vertices[start + i]; }
+				AddArray(name, copy, compress);
+			}
+		}
+
+		// standard random engines write their state as text, which keeps it exact across builds
+		template <class G>
+		void AddGenerator(const std::string& name, const G& generator) {
+			std::ostringstream stream;
+			stream << generator;
+			const std::string state = stream.str();
+			AddSection(name, state.data(), state.size());
+		}
+
+		std::vector<unsigned char> SaveToMemory() const {
+			SnapshotHeader header;
+			header.sectionCount = static_cast<std::uint32_t>(m_sections.size());
+			std::vector<SnapshotSectionEntry> entries;
+			std::size_t offset = Align(sizeof(SnapshotHeader) + m_sections.size() * sizeof(SnapshotSectionEntry));
+			for (const Section& section : m_sections) {
+				entries.push_back(section.entry);
+				entries.back().offset = offset;
+				offset = Align(offset + section.bytes.size());
+			}
+			std::vector<unsigned char> bytes(offset, 0);
+			std::memcpy(bytes.data(), &header, sizeof(header));
+			if (!entries.empty()) { std::memcpy(bytes.data() + sizeof(header), entries.data(), entries.size() * sizeof(SnapshotSectionEntry)); }
+			for (std::size_t i = 0; i < m_sections.size(); ++i) {
+				std::copy(m_sections[i].bytes.begin(), m_sections[i].bytes.end(), bytes.begin() + static_cast<std::ptrdiff_t>(entries[i].offset));
+			}
+			return bytes;
+		}
+
+		bool SaveToFile(const std::string& file) const {
+			const std::vector<unsigned char> bytes = SaveToMemory();
+			std::ofstream stream(file, std::ios::binary);
+			stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			return static_cast<bool>(stream);
+		}
+
+		void Clear() {
+			m_sections.clear();
+		}
+
+	private:
+
+		struct Section {
+			SnapshotSectionEntry entry;
+			std::vector<unsigned char> bytes;
+		};
+
+		static std::size_t Align(const std::size_t offset) {
+			return (offset + SnapshotAlignment - 1) / SnapshotAlignment * SnapshotAlignment;
+		}
+
+		std::vector<Section> m_sections;
+	};
+
+	// NOTE:
+	// - every section is checked against the size of the snapshot when it is loaded. compressed
+	//   sections are decompressed at load time, the rest are used where they are
+	// - reading a section as a type whose size differs from the one it was written with fails
+	class SnapshotReader {
+	public:
+
+		SnapshotReader() = default;
+
+		bool LoadFromFile(const std::string& file) {
+			std::ifstream stream(file, std::ios::binary | std::ios::ate);
+			if (!stream) { return false; }
+			const std::size_t size = static_cast<std::size_t>(stream.tellg());
+			stream.seekg(0);
+			m_storage.reset(new Block[(size + sizeof(Block) - 1) / sizeof(Block)]);
+			if (!stream.read(reinterpret_cast<char*>(m_storage.get()), static_cast<std::streamsize>(size))) { return false; }
+			return Parse(reinterpret_cast<const unsigned char*>(m_storage.get()), size);
+		}
+
+		// NOTE:
+		// - when data starts on a SnapshotAlignment boundary it is not copied and must stay alive
+		//   while the reader is used. memory mapping the file and passing the mapping here only
+		//   copies the compressed sections
+		// - anything else (e.g. the buffer of a std::vector) is copied first so sections are never
+		//   read through misaligned pointers
+		bool LoadFromMemory(const void* data, const std::size_t size) {
+			if (reinterpret_cast<std::uintptr_t>(data) % SnapshotAlignment == 0) {
+				m_storage.reset();
+				return Parse(static_cast<const unsigned char*>(data), size);
+			}
+			m_storage.reset(new Block[(size + sizeof(Block) - 1) / sizeof(Block)]);
+			std::memcpy(m_storage.get(), data, size);
+			return Parse(reinterpret_cast<const unsigned char*>(m_storage.get()), size);
+		}
+
+		bool HasSection(const std::string& name) const {
+			return m_sections.find(name) != m_sections.end();
+		}
+
+		const void* GetSectionData(const std::string& name) const {
+			const auto found = m_sections.find(name);
+			return found == m_sections.end() ? nullptr : found->second.data;
+		}
+
+		std::size_t GetSectionSize(const std::string& name) const {
+			const auto found = m_sections.find(name);
+			return found == m_sections.end() ? 0 : found->second.size;
+		}
+
+		// points into the snapshot. returns nullptr if the section is missing or holds another type
+		template <class T>
+		const T* GetArray(const std::string& name, std::size_t& count) const {
+			static_assert(std::is_trivially_copyable_v<T>, "snapshots only store trivially copyable types");
+			const auto found = m_sections.find(name);
+			count = 0;
+			if (found == m_sections.end() || found->second.elementSize != sizeof(T)) { return nullptr; }
+			count = found->second.size / sizeof(T);
+			return static_cast<const T*>(found->second.data);
+		}
+
+		template <class T>
+		bool ReadArray(const std::string& name, std::vector<T>& data) const {
+			std::size_t count = 0;
+			const T* source = GetArray<T>(name, count);
+			if (source == nullptr) { return false; }
+			data.resize(count);
+			if (count > 0) { std::memcpy(data.data(), source, count * sizeof(T)); }
+			return true;
+		}
+
+		template <class T>
+		bool ReadValue(const std::string& name, T& value) const {
+			std::size_t count = 0;
+			const T* source = GetArray<T>(name, count);
+			if (source == nullptr || count != 1) { return false; }
+			std::memcpy(&value, source, sizeof(T));
+			return true;
+		}
+
+		// NOTE:
+		// - copies the section into vertices starting at start. vertices must already be large enough
+		template <class V>
+		bool ReadVertices(const std::string& name, V& vertices, const std::size_t start) const {
+			using Vertex = VertexTypeOf<V>;
+			std::size_t count = 0;
+			const Vertex* source = GetArray<Vertex>(name, count);
+			if (source == nullptr) { return false; }
+			if constexpr (IsContiguousVertexContainerV<V>) {
+				if (count > 0) { std::memcpy(MakeVertexSpan(vertices, start, count).data(), source, count * sizeof(Vertex)); }
+			}
+			else {
+				for (std::size_t i = 0; i < count; ++i) { vertices[start + i] = source[i]; }
+			}
+			return true;
+		}
+
+		template <class G>
+		bool ReadGenerator(const std::string& name, G& generator) const {
+			const auto found = m_sections.find(name);
+			if (found == m_sections.end()) { return false; }
+			std::istringstream stream(std::string(static_cast<const char*>(found->second.data), found->second.size));
+			G restored;
+			if (!(stream >> restored)) { return false; }
+			generator = restored;
+			return true;
+		}
+
+	private:
+
+		struct alignas(SnapshotAlignment) Block {
+			unsigned char bytes[SnapshotAlignment];
+		};
+
+		struct Section {
+			const void* data = nullptr;
+			std::size_t size = 0;
+			std::size_t elementSize = 1;
+		};
+
+		bool Parse(const unsigned char* data, const std::size_t size) {
+			m_sections.clear();
+			m_decompressed.clear();
+			SnapshotHeader header;
+			if (size < sizeof(header)) { return false; }
+			std::memcpy(&header, data, sizeof(header));
+			const SnapshotHeader expected;
+			if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0) { return false; }
+			if (header.byteOrder != expected.byteOrder || header.version != SnapshotVersion) { return false; }
+			if (header.sectionCount > (size - sizeof(header)) / sizeof(SnapshotSectionEntry)) { return false; }
+
+			for (std::uint32_t i = 0; i < header.sectionCount; ++i) {
+				SnapshotSectionEntry entry;
+				std::memcpy(&entry, data + sizeof(header) + i * sizeof(entry), sizeof(entry));
+				if (entry.offset > size || entry.storedSize > size - entry.offset || entry.elementSize == 0) { return false; }
+				if (entry.size % entry.elementSize != 0) { return false; }
+				entry.name[sizeof(entry.name) - 1] = '\0';
+				Section section;
+				section.size = static_cast<std::size_t>(entry.size);
+				section.elementSize = entry.elementSize;
+				if (entry.compressed) {
+					// every stored byte expands to at most 255 bytes, checked before the size is trusted for allocating
+					if (entry.size > entry.storedSize * 255 + 16 || entry.size > std::numeric_limits<std::size_t>::max() - sizeof(Block)) { return false; }
+					std::unique_ptr<Block[]> buffer(new Block[(section.size + sizeof(Block) - 1) / sizeof(Block)]);
+					if (!DecompressLZ(data + entry.offset, static_cast<std::size_t>(entry.storedSize), reinterpret_cast<unsigned char*>(buffer.get()), section.size)) { return false; }
+					section.data = buffer.get();
+					m_decompressed.push_back(std::move(buffer));
+				}
+				else {
+					// GetArray() hands these out as typed pointers so they must keep the alignment they were written with
+					if (entry.storedSize != entry.size || entry.offset % SnapshotAlignment != 0) { return false; }
+					section.data = data + entry.offset;
+				}
+				m_sections[entry.name] = section;
+			}
+			return true;
+		}
+
+		std::unique_ptr<Block[]> m_storage; // the file read by LoadFromFile()
+		std::vector<std::unique_ptr<Block[]>> m_decompressed;
+		std::unordered_map<std::string, Section> m_sections;
+	};
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			KEYS
+	------------------------------------------------------------
+	-	GetSortableKey()
+
+	------------------------------------------------------------
+			SORTING
+	------------------------------------------------------------
+	-	RadixSortIndices()
+	-	ApplyPermutation()
+
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	KEYS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - maps a float to an unsigned integer with the same ordering so floats
+	//   (like depths) can be radix sorted
+	inline std::uint32_t GetSortableKey(const float value) {
+		std::uint32_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	SORTING
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - stable LSD radix sort 8 bits at a time. indices ends up holding the
+	//   positions of the keys in ascending order (keys itself is left untouched)
+	// - passes where every key has the same byte are skipped so keys that only
+	//   use their low bits cost fewer passes
+	// - scratch is only used as working memory. keeping both vectors around
+	//   between calls means sorting does not allocate
+	template <typename K>
+	void RadixSortIndices(const K* keys, const std::size_t count, std::vector<std::uint32_t>& indices, std::vector<std::uint32_t>& scratch) {
+		static_assert(std::is_integral_v<K> && std::is_unsigned_v<K>, "radix sort keys must be unsigned integers");
+		indices.resize(count);
+		scratch.resize(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			indices[i] = static_cast<std::uint32_t>(i);
+		}
+		std::uint32_t* src = indices.data();
+		std::uint32_t* dst = scratch.data();
+		for (std::size_t pass = 0; pass < sizeof(K); ++pass) {
+			const unsigned int shift = static_cast<unsigned int>(pass * 8);
+			std::size_t histogram[256] = {};
+			for (std::size_t i = 0; i < count; ++i) {
+				++histogram[(keys[i] >> shift) & 0xFFu];
+			}
+			if (count == 0 || histogram[(keys[0] >> shift) & 0xFFu] == count) { continue; }
+			std::size_t offset = 0;
+			for (std::size_t b = 0; b < 256; ++b) {
+				const std::size_t c = histogram[b];
+				histogram[b] = offset;
+				offset += c;
+			}
+			for (std::size_t i = 0; i < count; ++i) {
+				const std::uint32_t index = src[i];
+				dst[histogram[(keys[index] >> shift) & 0xFFu]++] = index;
+			}
+			std::swap(src, dst);
+		}
+		if (src != indices.data()) {
+			indices.swap(scratch);
+		}
+	}
+
+	// NOTE:
+	// - reorders values so values[i] becomes the old values[permutation[i]], which is
+	//   the order RadixSortIndices() and SortQuads() leave their indices in
+	template <class T>
+	void ApplyPermutation(T* values, const std::uint32_t* permutation, const std::size_t count, std::vector<T>& scratch) {
+		scratch.clear();
+		scratch.reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			scratch.push_back(std::move(values[permutation[i]]));
+		}
+		std::move(scratch.begin(), scratch.end(), values);
+	}
+
+	template <class T>
+	void ApplyPermutation(std::vector<T>& values, const std::vector<std::uint32_t>& permutation) {
+		std::vector<T> scratch;
+		ApplyPermutation(values.data(), permutation.data(), permutation.size(), scratch);
+	}
+
+}
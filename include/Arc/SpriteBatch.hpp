@@ -0,0 +1,209 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Submit()
+	-	Flush()
+	-	Clear()
+	-	GetSpriteCount()
+	-	GetStats()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		sf::RenderWindow window({ 800, 600 }, "Sprite Batch");
+
+		sf::Texture player, tiles;
+		player.loadFromFile("player.png");
+		tiles.loadFromFile("tiles.png");
+
+		Arc::SpriteBatch batch;
+
+		while (window.isOpen()) {
+
+			// sprites can be submitted in any order
+			batch.Submit(&tiles, { 0.0f, 0.0f, 32.0f, 32.0f }, { 64.0f, 64.0f }, sf::Color::White, 0.0f);
+			batch.Submit(&player, { 0.0f, 0.0f, 16.0f, 16.0f }, Arc::Affine2().Rotate(45.0f).Translate({ 200.0f, 200.0f }), sf::Color::White, 1.0f);
+			batch.Submit(&tiles, { 32.0f, 0.0f, 32.0f, 32.0f }, { 96.0f, 64.0f }, sf::Color::White, 0.0f);
+
+			window.clear();
+			batch.Flush(window); // two draw calls: both tiles, then the player on top
+			window.display();
+
+			const Arc::SpriteBatchStats& stats = batch.GetStats();
+
+		}
+
+	}
+
+*/
+
+#include "QuadUtils.hpp"
+#include "Sorting.hpp"
+#include "TextureAtlas.hpp"
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Clock.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Arc {
+
+	struct SpriteBatchStats {
+		std::size_t sprites = 0;
+		std::size_t drawCalls = 0;
+		std::size_t vertices = 0;
+		sf::Time sortTime;
+	};
+
+	// NOTE:
+	// - sprites are written into persistent vertex storage as they are submitted.
+	//   on Flush() they are sorted by depth (lowest first) and then by texture with
+	//   a stable radix sort and every run of the same texture is one draw call
+	// - sprites with the same depth and texture keep their submission order
+	// - textures must stay alive until the next Flush()
+	class SpriteBatch {
+	public:
+
+		SpriteBatch() = default;
+
+		// NOTE:
+		// - the sprite is a textureRect sized quad with its top left at the origin
+		//   which is then moved by transform
+		void Submit(const sf::Texture* texture, const sf::FloatRect& textureRect, const Affine2& transform, const sf::Color& color = sf::Color::White, const float depth = 0.0f) {
+			const std::size_t id = Push(texture, textureRect, color, depth);
+			ApplyQuadTransform(m_vertices, id, transform);
+		}
+
+		void Submit(const sf::Texture* texture, const sf::FloatRect& textureRect, const sf::Vector2f& position, const sf::Color& color = sf::Color::White, const float depth = 0.0f) {
+			const std::size_t id = Push(texture, textureRect, color, depth);
+			MoveQuad(m_vertices, id, position);
+		}
+
+		template <typename T>
+		void Submit(const BasicTextureAtlas<T>& atlas, const std::size_t cell, const Affine2& transform, const sf::Color& color = sf::Color::White, const float depth = 0.0f) {
+			Submit(&atlas.GetTexture(), sf::FloatRect(atlas.GetGetRect(cell)), transform, color, depth);
+		}
+
+		template <typename T>
+		void Submit(const BasicTextureAtlas<T>& atlas, const std::size_t cell, const sf::Vector2f& position, const sf::Color& color = sf::Color::White, const float depth = 0.0f) {
+			Submit(&atlas.GetTexture(), sf::FloatRect(atlas.GetGetRect(cell)), position, color, depth);
+		}
+
+		void Flush(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) {
+			const std::size_t count = m_textures.size();
+			m_stats = {};
+			m_stats.sprites = count;
+			m_stats.vertices = count * 4;
+			if (count == 0) { return; }
+
+			sf::Clock clock;
+			// textures get a small id in order of first use. the depth goes in the
+			// high half of the key so it is sorted on first
+			m_textureIds.clear();
+			m_keys.resize(count);
+			for (std::size_t i = 0; i < count; ++i) {
+				m_keys[i] = (static_cast<std::uint64_t>(GetSortableKey(m_depths[i])) << 32) | GetTextureId(m_textures[i]);
+			}
+			RadixSortIndices(m_keys.data(), count, m_order, m_scratch);
+			m_sorted.resize(count * 4);
+			for (std::size_t i = 0; i < count; ++i) {
+				const std::size_t src = static_cast<std::size_t>(m_order[i]) * 4;
+				const std::size_t dst = i * 4;
+				m_sorted[dst + 0] = m_vertices[src + 0];
+				m_sorted[dst + 1] = m_vertices[src + 1];
+				m_sorted[dst + 2] = m_vertices[src + 2];
+				m_sorted[dst + 3] = m_vertices[src + 3];
+			}
+			m_stats.sortTime = clock.getElapsedTime();
+
+			std::size_t first = 0;
+			while (first < count) {
+				const sf::Texture* texture = m_textures[m_order[first]];
+				std::size_t last = first + 1;
+				while (last < count && m_textures[m_order[last]] == texture) { ++last; }
+				states.texture = texture;
+				target.draw(&m_sorted[first * 4], (last - first) * 4, sf::Quads, states);
+				++m_stats.drawCalls;
+				first = last;
+			}
+			Clear();
+		}
+
+		// NOTE:
+		// - drops everything submitted since the last Flush() but keeps the memory
+		void Clear() {
+			m_vertices.clear();
+			m_textures.clear();
+			m_depths.clear();
+		}
+
+		std::size_t GetSpriteCount() const {
+			return m_textures.size();
+		}
+
+		// NOTE:
+		// - counters from the last Flush()
+		const SpriteBatchStats& GetStats() const {
+			return m_stats;
+		}
+
+	private:
+
+		std::size_t Push(const sf::Texture* texture, const sf::FloatRect& textureRect, const sf::Color& color, const float depth) {
+			const std::size_t id = m_textures.size();
+			m_vertices.resize(m_vertices.size() + 4);
+			MakeRect(m_vertices, id, { 0.0f, 0.0f, textureRect.width, textureRect.height });
+			SetQuadTextureRect(m_vertices, id, textureRect);
+			SetQuadColor(m_vertices, id, color);
+			m_textures.push_back(texture);
+			m_depths.push_back(depth);
+			return id;
+		}
+
+		std::uint32_t GetTextureId(const sf::Texture* texture) {
+			return m_textureIds.emplace(texture, static_cast<std::uint32_t>(m_textureIds.size())).first->second;
+		}
+
+		std::vector<sf::Vertex> m_vertices;
+		std::vector<sf::Vertex> m_sorted;
+		std::vector<const sf::Texture*> m_textures;
+		std::unordered_map<const sf::Texture*, std::uint32_t> m_textureIds; // cleared every Flush()
+		std::vector<float> m_depths;
+		std::vector<std::uint64_t> m_keys;
+		std::vector<std::uint32_t> m_order;
+		std::vector<std::uint32_t> m_scratch;
+		SpriteBatchStats m_stats;
+	};
+
+}
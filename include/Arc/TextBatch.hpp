@@ -0,0 +1,367 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			FORMATTING
+	------------------------------------------------------------
+	-	FormatNumber()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Create()
+	-	AddLabel()
+	-	SetString()
+	-	SetNumber()
+	-	SetLabelPosition()
+	-	SetLabelColor()
+	-	Draw()
+	-	GetVertices()
+	-	GetLabelCount()
+	-	GetGlyphCount()
+	-	GetAtlas()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::ResourceManager<std::string, sf::Font> fonts;
+		fonts.AddFile("hud", "resources/font.ttf");
+		fonts.LoadResource("hud");
+
+		Arc::TextBatch text;
+		text.Create(fonts.GetResource("hud"), 16); // glyphs are copied into a 16x16 cell texture atlas when first used
+
+		const std::size_t score = text.AddLabel({ 10.0f, 10.0f }, 16); // room for 16 characters
+		const std::size_t fps = text.AddLabel({ 10.0f, 40.0f }, 16, sf::Color::Yellow);
+
+		// every frame. only the glyphs that differ from the previous string are rewritten
+		text.SetNumber(score, points);
+		text.SetNumber(fps, 1.0f / dt.asSeconds(), 1);
+
+		text.Draw(window); // every label in one draw call
+
+	}
+
+*/
+
+#include "Profiling.hpp"
+#include "TextureAtlas.hpp"
+#include "VertexArrayUtils.hpp"
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	FORMATTING
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - writes the number into buffer without allocating and returns the number of characters
+	//   written. nothing is null terminated and 0 is returned if the buffer is too small
+	template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+	std::size_t FormatNumber(char* buffer, const std::size_t size, const T value) {
+		using Wide = std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>;
+		const std::to_chars_result result = std::to_chars(buffer, buffer + size, static_cast<Wide>(value));
+		return result.ec == std::errc() ? static_cast<std::size_t>(result.ptr - buffer) : 0;
+	}
+
+	// NOTE:
+	// - fixed notation with 0 to 9 decimals, rounded half away from zero
+	// - values too large for 64 bit fixed point fall back to snprintf
+	inline std::size_t FormatNumber(char* buffer, const std::size_t size, const double value, int decimals = 2) {
+		decimals = std::max(0, std::min(decimals, 9));
+		if (!std::isfinite(value)) {
+			const std::string_view text = std::isnan(value) ? "nan" : (value < 0.0 ? "-inf" : "inf");
+			if (text.size() > size) { return 0; }
+			text.copy(buffer, text.size());
+			return text.size();
+		}
+		unsigned long long scale = 1;
+		for (int i = 0; i < decimals; ++i) { scale *= 10; }
+		const double scaled = std::fabs(value) * static_cast<double>(scale) + 0.5;
+		if (scaled >= 9.0e18) {
+			const int written = std::snprintf(buffer, size, "%.*f", decimals, value);
+			return written >= 0 && static_cast<std::size_t>(written) < size ? static_cast<std::size_t>(written) : 0;
+		}
+		const unsigned long long fixed = static_cast<unsigned long long>(scaled);
+		const unsigned long long whole = fixed / scale;
+		unsigned long long fraction = fixed % scale;
+
+		std::size_t length = 0;
+		if (value < 0.0 && fixed != 0) {
+			if (size == 0) { return 0; }
+			buffer[length++] = '-';
+		}
+		const std::to_chars_result result = std::to_chars(buffer + length, buffer + size, whole);
+		if (result.ec != std::errc()) { return 0; }
+		length = static_cast<std::size_t>(result.ptr - buffer);
+		if (decimals == 0) { return length; }
+		if (length + 1 + static_cast<std::size_t>(decimals) > size) { return 0; }
+		buffer[length++] = '.';
+		for (int i = decimals - 1; i >= 0; --i) {
+			buffer[length + static_cast<std::size_t>(i)] = static_cast<char>('0' + fraction % 10);
+			fraction /= 10;
+		}
+		return length + static_cast<std::size_t>(decimals);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	TEXT BATCH
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - every label is a fixed number of glyph quads in one shared vertex array drawn with
+	//   one draw call. glyphs are copied from the font into a TextureAtlas the first time
+	//   they are used so every label can share one texture
+	// - SetString() remembers the character and pen position of every quad and only rewrites
+	//   the quads where either changed, so updating a number usually touches a few quads
+	// - strings are read as Latin-1 bytes. characters that no longer fit in the atlas are
+	//   not drawn but still advance the pen
+	// - glyph quads are laid out like sf::Text, with the first baseline one character size
+	//   below the label position and 1 pixel of padding around each glyph
+	// - the font must outlive the batch
+	class TextBatch {
+	public:
+
+		TextBatch() = default;
+
+		bool Create(const sf::Font& font, const unsigned int characterSize, const sf::Vector2u& atlasGridSize = { 16, 16 }) {
+			m_font = &font;
+			m_characterSize = characterSize;
+			m_lineSpacing = font.getLineSpacing(characterSize);
+			m_glyphs.clear();
+			m_ascii.fill(-1);
+			m_other.clear();
+			m_nextCell = 0;
+			m_labels.clear();
+			m_characters.clear();
+			m_pens.clear();
+			m_vertices.clear();
+			// cells fit the largest Latin-1 glyph so no glyph is clipped by its neighbours
+			int largest = static_cast<int>(std::ceil(std::max(m_lineSpacing, static_cast<float>(characterSize))));
+			for (std::uint32_t character = 32; character < 256; ++character) {
+				const sf::IntRect& rect = font.getGlyph(character, characterSize, false).textureRect;
+				largest = std::max({ largest, rect.width, rect.height });
+			}
+			const unsigned int cell = static_cast<unsigned int>(largest) + 2;
+			return m_atlas.Create(atlasGridSize, { cell, cell });
+		}
+
+		// returns the id of the label. capacity is the most characters the label can show
+		std::size_t AddLabel(const sf::Vector2f& position, const std::size_t capacity, const sf::Color& color = sf::Color::White) {
+			Label label;
+			label.position = position;
+			label.color = color;
+			label.first = m_characters.size();
+			label.capacity = capacity;
+			m_labels.push_back(label);
+			m_characters.resize(m_characters.size() + capacity, 0);
+			m_pens.resize(m_pens.size() + capacity);
+			const std::size_t start = m_vertices.size();
+			m_vertices.resize(start + 4 * capacity);
+			ResetVertexArray(m_vertices, start, 4 * capacity);
+			return m_labels.size() - 1;
+		}
+
+		// returns how many glyph quads were rewritten. text past the label's capacity is cut off
+		std::size_t SetString(const std::size_t id, const std::string_view& text) {
+			Label& label = m_labels[id];
+			const std::size_t length = std::min(text.size(), label.capacity);
+			const std::size_t glyphs = m_glyphs.size();
+			std::size_t written = 0;
+			sf::Vector2f pen(0.0f, static_cast<float>(m_characterSize));
+			std::uint32_t previous = 0;
+			for (std::size_t i = 0; i < length; ++i) {
+				const std::uint32_t character = static_cast<unsigned char>(text[i]);
+				const std::size_t slot = label.first + i;
+				if (character == '\n') {
+					pen = { 0.0f, pen.y + m_lineSpacing };
+					previous = 0;
+				}
+				else {
+					pen.x += m_font->getKerning(previous, character, m_characterSize);
+				}
+				const int glyph = character == '\n' ? -1 : static_cast<int>(GetGlyph(character));
+				if (i >= label.length || m_characters[slot] != character || m_pens[slot] != pen) {
+					m_characters[slot] = character;
+					m_pens[slot] = pen;
+					WriteGlyph(slot, glyph, label.position + pen, label.color);
+					++written;
+				}
+				if (glyph >= 0) {
+					pen.x += m_glyphs[static_cast<std::size_t>(glyph)].advance;
+					previous = character;
+				}
+			}
+			for (std::size_t i = length; i < label.length; ++i) {
+				m_characters[label.first + i] = 0;
+				ResetVertexArray(m_vertices, (label.first + i) * 4, 4);
+				++written;
+			}
+			label.length = length;
+			if (m_glyphs.size() != glyphs) { m_atlas.Display(); }
+			ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4 * written);
+			return written;
+		}
+
+		template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+		std::size_t SetNumber(const std::size_t id, const T value) {
+			char buffer[32];
+			return SetString(id, { buffer, FormatNumber(buffer, sizeof(buffer), value) });
+		}
+
+		std::size_t SetNumber(const std::size_t id, const double value, const int decimals = 2) {
+			char buffer[64];
+			return SetString(id, { buffer, FormatNumber(buffer, sizeof(buffer), value, decimals) });
+		}
+
+		void SetLabelPosition(const std::size_t id, const sf::Vector2f& position) {
+			Label& label = m_labels[id];
+			MoveVertexArray(m_vertices, label.first * 4, label.length * 4, position - label.position);
+			label.position = position;
+		}
+
+		void SetLabelColor(const std::size_t id, const sf::Color& color) {
+			Label& label = m_labels[id];
+			SetVertexArrayColor(m_vertices, label.first * 4, label.length * 4, color);
+			label.color = color;
+		}
+
+		void Draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) const {
+			if (m_vertices.empty()) { return; }
+			states.texture = &m_atlas.GetTexture();
+			target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+		}
+
+		const std::vector<sf::Vertex>& GetVertices() const { return m_vertices; }
+
+		std::size_t GetLabelCount() const { return m_labels.size(); }
+
+		// glyphs cached so far, including whitespace and glyphs that got no atlas cell
+		std::size_t GetGlyphCount() const { return m_glyphs.size(); }
+
+		const TextureAtlas& GetAtlas() const { return m_atlas; }
+
+	private:
+
+		struct Glyph {
+			sf::FloatRect bounds; // relative to the pen, padding included
+			sf::FloatRect textureRect; // in the atlas, padding included
+			float advance = 0.0f;
+		};
+
+		struct Label {
+			sf::Vector2f position;
+			sf::Color color;
+			std::size_t first = 0;
+			std::size_t capacity = 0;
+			std::size_t length = 0;
+		};
+
+		// NOTE:
+		// - glyphs that do not get an atlas cell, because the atlas is full or the glyph does not
+		//   fit in a cell, are cached without a texture rect so they are not drawn but still advance
+		std::size_t GetGlyph(const std::uint32_t character) {
+			if (character < m_ascii.size() && m_ascii[character] >= 0) { return static_cast<std::size_t>(m_ascii[character]); }
+			if (character >= m_ascii.size()) {
+				const auto found = m_other.find(character);
+				if (found != m_other.end()) { return static_cast<std::size_t>(found->second); }
+			}
+
+			const sf::Glyph& source = m_font->getGlyph(character, m_characterSize, false);
+			Glyph glyph;
+			glyph.advance = source.advance;
+			const sf::Vector2u gridSize = m_atlas.GetGridSize();
+			const sf::Vector2u cellSize = m_atlas.GetCellSize();
+			const bool empty = source.textureRect.width <= 0 || source.textureRect.height <= 0;
+			const bool fits = static_cast<unsigned int>(source.textureRect.width) + 2 <= cellSize.x && static_cast<unsigned int>(source.textureRect.height) + 2 <= cellSize.y;
+			if (!empty && fits && m_nextCell < static_cast<std::size_t>(gridSize.x) * gridSize.y) {
+				const sf::IntRect rect(source.textureRect.left - 1, source.textureRect.top - 1, source.textureRect.width + 2, source.textureRect.height + 2);
+				m_atlas.CopyToCell(m_nextCell, m_font->getTexture(m_characterSize), rect);
+				const sf::IntRect& cell = m_atlas.GetGetRect(m_nextCell);
+				glyph.bounds = { source.bounds.left - 1.0f, source.bounds.top - 1.0f, source.bounds.width + 2.0f, source.bounds.height + 2.0f };
+				glyph.textureRect = { static_cast<float>(cell.left), static_cast<float>(cell.top), static_cast<float>(rect.width), static_cast<float>(rect.height) };
+				++m_nextCell;
+			}
+			const std::size_t index = m_glyphs.size();
+			m_glyphs.push_back(glyph);
+			if (character < m_ascii.size()) { m_ascii[character] = static_cast<int>(index); }
+			else { m_other[character] = static_cast<int>(index); }
+			return index;
+		}
+
+		void WriteGlyph(const std::size_t slot, const int glyph, const sf::Vector2f& pen, const sf::Color& color) {
+			const std::size_t idx = slot * 4;
+			if (glyph < 0 || m_glyphs[static_cast<std::size_t>(glyph)].textureRect.width <= 0.0f) {
+				ResetVertexArray(m_vertices, idx, 4);
+				return;
+			}
+			const Glyph& g = m_glyphs[static_cast<std::size_t>(glyph)];
+			const float left = pen.x + g.bounds.left;
+			const float top = pen.y + g.bounds.top;
+			const float right = left + g.bounds.width;
+			const float bottom = top + g.bounds.height;
+			const float u0 = g.textureRect.left;
+			const float v0 = g.textureRect.top;
+			const float u1 = u0 + g.textureRect.width;
+			const float v1 = v0 + g.textureRect.height;
+			m_vertices[idx + 0] = sf::Vertex({ left, top }, color, { u0, v0 });
+			m_vertices[idx + 1] = sf::Vertex({ right, top }, color, { u1, v0 });
+			m_vertices[idx + 2] = sf::Vertex({ right, bottom }, color, { u1, v1 });
+			m_vertices[idx + 3] = sf::Vertex({ left, bottom }, color, { u0, v1 });
+		}
+
+		const sf::Font* m_font = nullptr;
+		unsigned int m_characterSize = 0;
+		float m_lineSpacing = 0.0f;
+		TextureAtlas m_atlas;
+		std::vector<Glyph> m_glyphs;
+		std::array<int, 128> m_ascii{}; // glyph of each ascii character or -1
+		std::unordered_map<std::uint32_t, int> m_other;
+		std::size_t m_nextCell = 0;
+		std::vector<Label> m_labels;
+		std::vector<std::uint32_t> m_characters; // the character in each quad
+		std::vector<sf::Vector2f> m_pens; // the pen position of each quad relative to its label
+		std::vector<sf::Vertex> m_vertices;
+	};
+
+}
@@ -31,6 +31,7 @@
 	------------------------------------------------------------
 	-	Create()
 	-	EditCell()
+	-	CopyToCell()
 	-	Clear()
 	-	Display()
 	-	GetTexture()
@@ -80,9 +81,12 @@
 
 */
 
+#include "Profiling.hpp"
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <algorithm>
+#include <string>
 #include <vector>
 
 namespace Arc {
@@ -107,18 +111,19 @@ namespace Arc {
 			for (unsigned int y = 0; y < m_gridSize.y; ++y) {
 				const T Y = static_cast<T>(y) * static_cast<T>(cellSize.y);
 				for (unsigned int x = 0; x < m_gridSize.x; ++x) {
-					const T X = static_cast<T>(x) * static_cast<T>(m_cellSize.y);
+					const T X = static_cast<T>(x) * static_cast<T>(m_cellSize.x);
 					m_rects[idx] = { X, Y, static_cast<T>(m_cellSize.x), static_cast<T>(m_cellSize.y) };
 					++idx;
 				}
 			}
-			if (!m_texture.create(m_gridSize.x, m_gridSize.y)) { return false; }
+			if (!m_texture.create(m_gridSize.x * m_cellSize.x, m_gridSize.y * m_cellSize.y)) { return false; }
 			Clear();
 			return true;
 		}
 
 		bool EditCell(const std::size_t index, const sf::Texture& texture, const sf::IntRect& rect = sf::IntRect()) {
 			if (index >= m_rects.size()) { return false; }
+			ARC_PROFILE_COUNT(ProfileCounter::AtlasEdits, 1);
 			sf::RectangleShape r;
 			r.setPosition(sf::Vector2f(sf::Vector2<T>(m_rects[index].left, m_rects[index].top)));
 			r.setSize(sf::Vector2f(sf::Vector2<T>(m_rects[index].width, m_rects[index].height)));
@@ -129,48 +134,71 @@ namespace Arc {
 		}
 
 		bool EditCell(const sf::Vector2u& position, const sf::Texture& texture, const sf::IntRect& rect = sf::IntRect()) {
+			if (position.x >= m_gridSize.x || position.y >= m_gridSize.y) { return false; }
 			const unsigned int x = position.x * m_cellSize.x;
 			const unsigned int y = position.y * m_cellSize.y;
-			if (!(x <= m_gridSize.x) || !(y <= m_gridSize.y)) { return false; }
+			ARC_PROFILE_COUNT(ProfileCounter::AtlasEdits, 1);
 			sf::RectangleShape r;
 			r.setPosition(sf::Vector2f(sf::Vector2u(x, y)));
 			r.setSize(sf::Vector2f(m_cellSize));
 			r.setTexture(&texture);
 			r.setTextureRect(rect);
 			m_texture.draw(r);
+			return true;
 		}
 
 		bool EditCell(const sf::Vector2u& position, const sf::Vector2u& size, const sf::Texture& texture, const sf::IntRect& rect = sf::IntRect()) {
+			if (position.x + size.x > m_gridSize.x || position.y + size.y > m_gridSize.y) { return false; }
 			const unsigned int x = position.x * m_cellSize.x;
 			const unsigned int y = position.y * m_cellSize.y;
 			const unsigned int w = size.x * m_cellSize.x;
 			const unsigned int h = size.y * m_cellSize.y;
-			if (!(x <= m_gridSize.x) || !(y <= m_gridSize.y)) { return false; }
+			ARC_PROFILE_COUNT(ProfileCounter::AtlasEdits, 1);
 			sf::RectangleShape r;
 			r.setPosition(sf::Vector2f(sf::Vector2u(x, y)));
 			r.setSize(sf::Vector2f(sf::Vector2u(w, h)));
 			r.setTexture(&texture);
 			r.setTextureRect(rect);
 			m_texture.draw(r);
+			return true;
+		}
+
+		// NOTE:
+		// - unlike EditCell() the texture is not stretched to fill the cell. the rect is copied
+		//   pixel for pixel to the cell's top left corner and clipped to the cell size
+		// - the pixels are replaced instead of blended so copying onto a transparent cell keeps
+		//   the source alpha
+		bool CopyToCell(const std::size_t index, const sf::Texture& texture, const sf::IntRect& rect) {
+			if (index >= m_rects.size()) { return false; }
+			ARC_PROFILE_COUNT(ProfileCounter::AtlasEdits, 1);
+			const sf::IntRect clipped(rect.left, rect.top, std::min(rect.width, static_cast<int>(m_cellSize.x)), std::min(rect.height, static_cast<int>(m_cellSize.y)));
+			sf::RectangleShape r;
+			r.setPosition(sf::Vector2f(sf::Vector2<T>(m_rects[index].left, m_rects[index].top)));
+			r.setSize(sf::Vector2f(sf::Vector2i(clipped.width, clipped.height)));
+			r.setTexture(&texture);
+			r.setTextureRect(clipped);
+			m_texture.draw(r, sf::RenderStates(sf::BlendNone));
+			return true;
 		}
 
 		void Clear() { m_texture.clear(sf::Color::Transparent); }
 		void Display() { m_texture.display(); }
 		const sf::Texture& GetTexture() const { return m_texture.getTexture(); }
 		const sf::Vector2u& GetGridSize() const { return m_gridSize; }
-		const sf::Rect<T>& GetGetRect(const std::size_t index) { return m_rects[index]; };
+		const sf::Vector2u& GetCellSize() const { return m_cellSize; }
+		const sf::Rect<T>& GetGetRect(const std::size_t index) const { return m_rects[index]; };
 
-		const sf::Rect<T>& GetGetRect(const sf::Vector2u& gridPosition) {
+		sf::Rect<T> GetGetRect(const sf::Vector2u& gridPosition) const {
 			const unsigned int x = m_cellSize.x * gridPosition.x;
 			const unsigned int y = m_cellSize.y * gridPosition.y;
 			const sf::Vector2<T> siz = sf::Vector2<T>(m_cellSize);
 			return { static_cast<T>(x), static_cast<T>(y), siz.x, siz.y };
 		}
 		
-		const sf::Rect<T>& GetGetRect(const sf::Vector2u& gridPosition, const sf::Vector2u& size) {
+		sf::Rect<T> GetGetRect(const sf::Vector2u& gridPosition, const sf::Vector2u& size) const {
 			const unsigned int x = m_cellSize.x * gridPosition.x;
 			const unsigned int y = m_cellSize.y * gridPosition.y;
-			const unsigned int w = m_cellSize.y * size.y;
+			const unsigned int w = m_cellSize.x * size.x;
 			const unsigned int h = m_cellSize.y * size.y;
 			return { static_cast<T>(x), static_cast<T>(y), static_cast<T>(w), static_cast<T>(h) };
 		}
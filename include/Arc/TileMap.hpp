@@ -0,0 +1,254 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			TILE IDS
+	------------------------------------------------------------
+	-	MakeTileTexCoords()
+	-	ApplyTileIds()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	AddAnimation()
+	-	SetTiles()
+	-	Apply()
+	-	Update()
+	-	Reset()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::TextureAtlas atlas;
+		atlas.Create({ 8, 8 }, { 32, 32 });
+		// ... fill the atlas
+
+		// once per atlas. tile id i uses atlas cell i
+		const std::vector<Arc::TileTexCoords> lut = Arc::MakeTileTexCoords(atlas);
+
+		std::vector<std::uint16_t> ids(100 * 100); // the map. one tile id per quad
+		Arc::MakeGrid(vertices, 0, { 100, 100 }, { 32.0f, 32.0f });
+		Arc::ApplyTileIds(vertices, 0, ids.data(), ids.size(), lut); // every quad's texture coordinates in one pass
+
+		// tile 5 is water that cycles through the tiles 5, 6 and 7
+		Arc::TileAnimator animator;
+		animator.AddAnimation(5, { 5, 6, 7 }, 0.25f);
+		animator.SetTiles(ids.data(), ids.size());
+
+		// every frame. only the water tiles are rewritten and only when their frame changes
+		animator.Update(vertices, 0, dt.asSeconds(), lut);
+
+	}
+
+*/
+
+#include "Profiling.hpp"
+#include "TextureAtlas.hpp"
+#include "VertexArrayUtils.hpp"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	TILE IDS
+	//////////////////////////////////////////////////////////////////////
+
+	// the texture coordinates of a quad's 4 corners in the same order MakeRect() makes them
+	struct TileTexCoords {
+		sf::Vector2f corners[4];
+	};
+
+	template <typename T>
+	std::vector<TileTexCoords> MakeTileTexCoords(const sf::Rect<T>* rects, const std::size_t count) {
+		std::vector<TileTexCoords> lut(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			const sf::FloatRect rect(rects[i]);
+			lut[i].corners[0] = { rect.left, rect.top };
+			lut[i].corners[1] = { rect.left + rect.width, rect.top };
+			lut[i].corners[2] = { rect.left + rect.width, rect.top + rect.height };
+			lut[i].corners[3] = { rect.left, rect.top + rect.height };
+		}
+		return lut;
+	}
+
+	template <typename T>
+	std::vector<TileTexCoords> MakeTileTexCoords(const std::vector<sf::Rect<T>>& rects) {
+		return MakeTileTexCoords(rects.data(), rects.size());
+	}
+
+	// tile id i maps to the atlas cell with index i
+	template <typename T>
+	std::vector<TileTexCoords> MakeTileTexCoords(const BasicTextureAtlas<T>& atlas) {
+		const std::size_t count = static_cast<std::size_t>(atlas.GetGridSize().x) * atlas.GetGridSize().y;
+		std::vector<sf::Rect<T>> rects(count);
+		for (std::size_t i = 0; i < count; ++i) { rects[i] = atlas.GetGetRect(i); }
+		return MakeTileTexCoords(rects);
+	}
+
+	// NOTE:
+	// - writes the texture coordinates of vertices.size() / 4 quads, quad i gets lut[ids[i]]
+	// - every quad is a copy of 4 precomputed corners with no branches or rect math, so the
+	//   loop only streams through the ids and the texture coordinates
+	// - ids are not range checked. every id must be smaller than the size of lut
+	inline void ApplyTileIds(const VertexSpan& vertices, const std::uint16_t* ids, const TileTexCoords* lut) {
+		sf::Vertex* quad = vertices.data();
+		const std::size_t count = vertices.size() / 4;
+		for (std::size_t i = 0; i < count; ++i, quad += 4) {
+			const TileTexCoords& tile = lut[ids[i]];
+			quad[0].texCoords = tile.corners[0];
+			quad[1].texCoords = tile.corners[1];
+			quad[2].texCoords = tile.corners[2];
+			quad[3].texCoords = tile.corners[3];
+		}
+	}
+
+	template <class V>
+	void ApplyTileIds(V& vertices, const std::size_t firstId, const std::uint16_t* ids, const std::size_t count, const std::vector<TileTexCoords>& lut) {
+		ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4 * count);
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ApplyTileIds(MakeVertexSpan(vertices, firstId * 4, count * 4), ids, lut.data());
+		}
+		else {
+			using Traits = VertexTraitsOf<V>;
+			for (std::size_t i = 0; i < count; ++i) {
+				const TileTexCoords& tile = lut[ids[i]];
+				for (std::size_t j = 0; j < 4; ++j) { Traits::SetTexCoords(vertices[(firstId + i) * 4 + j], tile.corners[j]); }
+			}
+		}
+	}
+
+	template <class V>
+	void ApplyTileIds(V& vertices, const std::size_t firstId, const std::vector<std::uint16_t>& ids, const std::vector<TileTexCoords>& lut) {
+		ApplyTileIds(vertices, firstId, ids.data(), ids.size(), lut);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	ANIMATED TILES
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - every tile in the map whose id is the base id of an animation plays that animation
+	// - SetTiles() finds the animated tiles once. Update() then only advances each animation's
+	//   clock and rewrites the tiles of the animations whose frame changed, so a map with
+	//   a few animated tiles costs almost nothing on most frames
+	// - call SetTiles() again after changing the map's ids and Apply() after ApplyTileIds()
+	//   so the animated tiles show their current frame instead of their base id
+	class TileAnimator {
+	public:
+
+		TileAnimator() = default;
+
+		// frames are tile ids into the same lut the map uses. frameTime is in seconds
+		void AddAnimation(const std::uint16_t baseId, const std::vector<std::uint16_t>& frames, const float frameTime) {
+			if (frames.empty() || frameTime <= 0.0f) { return; }
+			if (m_lookup.size() <= baseId) { m_lookup.resize(static_cast<std::size_t>(baseId) + 1, -1); }
+			if (m_lookup[baseId] < 0) {
+				m_lookup[baseId] = static_cast<int>(m_animations.size());
+				m_animations.emplace_back();
+			}
+			Animation& animation = m_animations[static_cast<std::size_t>(m_lookup[baseId])];
+			animation.frames = frames;
+			animation.frameTime = frameTime;
+			animation.time = 0.0f;
+			animation.frame = 0;
+		}
+
+		void SetTiles(const std::uint16_t* ids, const std::size_t count) {
+			for (Animation& animation : m_animations) { animation.tiles.clear(); }
+			for (std::size_t i = 0; i < count; ++i) {
+				if (ids[i] < m_lookup.size() && m_lookup[ids[i]] >= 0) {
+					m_animations[static_cast<std::size_t>(m_lookup[ids[i]])].tiles.push_back(static_cast<std::uint32_t>(i));
+				}
+			}
+		}
+
+		void SetTiles(const std::vector<std::uint16_t>& ids) {
+			SetTiles(ids.data(), ids.size());
+		}
+
+		// writes the current frame of every animated tile
+		template <class V>
+		void Apply(V& vertices, const std::size_t firstId, const std::vector<TileTexCoords>& lut) const {
+			for (const Animation& animation : m_animations) { Write(vertices, firstId, animation, lut); }
+		}
+
+		// returns how many tiles were rewritten
+		template <class V>
+		std::size_t Update(V& vertices, const std::size_t firstId, const float seconds, const std::vector<TileTexCoords>& lut) {
+			std::size_t written = 0;
+			for (Animation& animation : m_animations) {
+				const float duration = animation.frameTime * static_cast<float>(animation.frames.size());
+				animation.time = std::fmod(animation.time + seconds, duration);
+				const std::size_t frame = std::min(static_cast<std::size_t>(animation.time / animation.frameTime), animation.frames.size() - 1);
+				if (frame == animation.frame) { continue; }
+				animation.frame = frame;
+				Write(vertices, firstId, animation, lut);
+				written += animation.tiles.size();
+			}
+			return written;
+		}
+
+		// restarts every animation from its first frame. call Apply() afterwards to show it
+		void Reset() {
+			for (Animation& animation : m_animations) {
+				animation.time = 0.0f;
+				animation.frame = 0;
+			}
+		}
+
+	private:
+
+		struct Animation {
+			std::vector<std::uint16_t> frames;
+			std::vector<std::uint32_t> tiles; // the quads in the map that play this animation
+			float frameTime = 0.0f;
+			float time = 0.0f;
+			std::size_t frame = 0;
+		};
+
+		template <class V>
+		static void Write(V& vertices, const std::size_t firstId, const Animation& animation, const std::vector<TileTexCoords>& lut) {
+			ARC_PROFILE_COUNT(ProfileCounter::QuadVertices, 4 * animation.tiles.size());
+			using Traits = VertexTraitsOf<V>;
+			const TileTexCoords& tile = lut[animation.frames[animation.frame]];
+			for (const std::uint32_t id : animation.tiles) {
+				const std::size_t idx = (firstId + id) * 4;
+				for (std::size_t j = 0; j < 4; ++j) { Traits::SetTexCoords(vertices[idx + j], tile.corners[j]); }
+			}
+		}
+
+		std::vector<Animation> m_animations;
+		std::vector<int> m_lookup; // the animation of each base id or -1
+	};
+
+}
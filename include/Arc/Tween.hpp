@@ -0,0 +1,311 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	Add()
+	-	AddOscillation()
+	-	AddVertexColor()
+	-	Stop()
+	-	Update()
+	-	GetTweenCount()
+	-	Clear()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::Tweener tweener;
+
+		float alpha = 0.0f;
+		sf::Vector2f position;
+
+		// the targets are written to directly on every update
+		tweener.Add(&alpha, 0.0f, 1.0f, 2.0f, Arc::Easing::Cosine);
+		tweener.Add(&position, { 0.0f, 0.0f }, { 300.0f, 100.0f }, 0.5f);
+
+		// fades the first 400 vertices of a vertex array from white to red over 3 seconds
+		sf::VertexArray vertices(sf::Quads, 400);
+		tweener.AddVertexColor(vertices, 0, 400, sf::Color::White, sf::Color::Red, 3.0f);
+
+		sf::Clock cl;
+		while (tweener.GetTweenCount() > 0) {
+			tweener.Update(cl.restart().asSeconds()); // finished tweens are removed automatically
+		}
+
+	}
+
+*/
+
+#include "Mathematics.hpp"
+#include <SFML/Graphics/Vertex.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace Arc {
+
+	// NOTE:
+	// - Linear and Cosine match Arc::Lerp() and Arc::CosineLerp() over the duration
+	// - Oscillate matches Arc::Oscillate() with the time since the tween started
+	enum class Easing {
+		Linear,
+		Cosine,
+		Oscillate
+	};
+
+	// NOTE:
+	// - tweens are stored as structures of arrays grouped by easing and value
+	//   type so an update is a handful of straight loops over contiguous data
+	//   instead of one scattered call per animated property
+	// - the tweener does not own the targets. they must stay valid (and vertex
+	//   arrays must not be resized) until the tween finishes or is stopped
+	class Tweener {
+	public:
+
+		Tweener() = default;
+
+		void Add(float* target, const float start, const float end, const float duration, const Easing easing = Easing::Linear) {
+			GetLane(m_floats, easing).Push(target, start, end, duration);
+		}
+
+		void Add(sf::Vector2f* target, const sf::Vector2f& start, const sf::Vector2f& end, const float duration, const Easing easing = Easing::Linear) {
+			GetLane(m_vectors, easing).Push(target, start, end, duration);
+		}
+
+		void Add(sf::Color* target, const sf::Color& start, const sf::Color& end, const float duration, const Easing easing = Easing::Linear) {
+			GetLane(m_colors, easing).Push(target, start, end, duration);
+		}
+
+		// NOTE:
+		// - oscillations run forever unless they are given a duration or stopped
+		template <typename T>
+		void AddOscillation(T* target, const T& minVal, const T& maxVal, const float frequency, const float phase = 0.0f, const float duration = std::numeric_limits<float>::infinity()) {
+			if constexpr (std::is_same_v<T, float>) { GetLane(m_floats, Easing::Oscillate).Push(target, minVal, maxVal, duration, frequency, phase); }
+			else if constexpr (std::is_same_v<T, sf::Vector2f>) { GetLane(m_vectors, Easing::Oscillate).Push(target, minVal, maxVal, duration, frequency, phase); }
+			else if constexpr (std::is_same_v<T, sf::Color>) { GetLane(m_colors, Easing::Oscillate).Push(target, minVal, maxVal, duration, frequency, phase); }
+			else { static_assert(sizeof(T) == 0, "only float, sf::Vector2f and sf::Color can oscillate"); }
+		}
+
+		template <class V>
+		void AddVertexColor(V& vertices, const std::size_t start, const std::size_t count, const sf::Color& from, const sf::Color& to, const float duration, const Easing easing = Easing::Linear) {
+			if (count == 0) { return; }
+			GetLane(m_vertexColors, easing).Push({ &vertices[start], count }, from, to, duration);
+		}
+
+		// NOTE:
+		// - stops every tween writing to target without touching its current value
+		void Stop(const void* target) {
+			for (auto& lane : m_floats) { lane.Remove(target); }
+			for (auto& lane : m_vectors) { lane.Remove(target); }
+			for (auto& lane : m_colors) { lane.Remove(target); }
+			for (auto& lane : m_vertexColors) { lane.Remove(target); }
+		}
+
+		void Update(const float dt) {
+			for (std::size_t i = 0; i < EasingCount; ++i) {
+				const Easing easing = static_cast<Easing>(i);
+				m_floats[i].Update(dt, easing, m_weights);
+				m_vectors[i].Update(dt, easing, m_weights);
+				m_colors[i].Update(dt, easing, m_weights);
+				m_vertexColors[i].Update(dt, easing, m_weights);
+			}
+		}
+
+		std::size_t GetTweenCount() const {
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < EasingCount; ++i) {
+				count += m_floats[i].elapsed.size() + m_vectors[i].elapsed.size() + m_colors[i].elapsed.size() + m_vertexColors[i].elapsed.size();
+			}
+			return count;
+		}
+
+		void Clear() {
+			for (std::size_t i = 0; i < EasingCount; ++i) {
+				m_floats[i].Clear();
+				m_vectors[i].Clear();
+				m_colors[i].Clear();
+				m_vertexColors[i].Clear();
+			}
+		}
+
+	private:
+
+		static constexpr std::size_t EasingCount = 3;
+
+		struct VertexRange {
+			sf::Vertex* first;
+			std::size_t count;
+		};
+
+		template <typename T, typename Target>
+		struct Lane {
+
+			void Push(const Target& target, const T& start, const T& end, const float duration, const float frequency = 0.0f, const float phase = 0.0f) {
+				targets.push_back(target);
+				starts.push_back(start);
+				ends.push_back(end);
+				elapsed.push_back(0.0f);
+				durations.push_back(duration);
+				frequencies.push_back(frequency);
+				phases.push_back(phase);
+			}
+
+			void Update(const float dt, const Easing easing, std::vector<float>& weights) {
+				const std::size_t count = elapsed.size();
+				if (count == 0) { return; }
+				weights.resize(count);
+				float* w = weights.data();
+				float* e = elapsed.data();
+				const float* d = durations.data();
+				for (std::size_t i = 0; i < count; ++i) {
+					e[i] = std::min(e[i] + dt, d[i]);
+				}
+				if (easing == Easing::Linear) {
+					for (std::size_t i = 0; i < count; ++i) { w[i] = d[i] > 0.0f ? e[i] / d[i] : 1.0f; }
+				}
+				else if (easing == Easing::Cosine) {
+					for (std::size_t i = 0; i < count; ++i) { w[i] = 0.5f * (1.0f - std::cos(Pi_v<float> * (d[i] > 0.0f ? e[i] / d[i] : 1.0f))); }
+				}
+				else {
+					const float* f = frequencies.data();
+					const float* p = phases.data();
+					for (std::size_t i = 0; i < count; ++i) { w[i] = 0.5f * (1.0f - std::cos(2.0f * Pi_v<float> * f[i] * e[i] + p[i])); }
+				}
+				for (std::size_t i = 0; i < count; ++i) {
+					Write(targets[i], Blend(starts[i], ends[i], w[i]));
+				}
+				// finished tweens are swapped with the last one so the arrays stay packed
+				std::size_t i = 0;
+				std::size_t last = count;
+				while (i < last) {
+					if (elapsed[i] >= durations[i]) {
+						--last;
+						MoveTo(last, i);
+					}
+					else {
+						++i;
+					}
+				}
+				Resize(last);
+			}
+
+			void Remove(const void* target) {
+				std::size_t i = 0;
+				std::size_t last = elapsed.size();
+				while (i < last) {
+					if (Address(targets[i]) == target) {
+						--last;
+						MoveTo(last, i);
+					}
+					else {
+						++i;
+					}
+				}
+				Resize(last);
+			}
+
+			void Clear() { Resize(0); }
+
+			std::vector<Target> targets;
+			std::vector<T> starts, ends;
+			std::vector<float> elapsed, durations, frequencies, phases;
+
+		private:
+
+			void MoveTo(const std::size_t from, const std::size_t to) {
+				targets[to] = targets[from];
+				starts[to] = starts[from];
+				ends[to] = ends[from];
+				elapsed[to] = elapsed[from];
+				durations[to] = durations[from];
+				frequencies[to] = frequencies[from];
+				phases[to] = phases[from];
+			}
+
+			void Resize(const std::size_t size) {
+				targets.resize(size);
+				starts.resize(size);
+				ends.resize(size);
+				elapsed.resize(size);
+				durations.resize(size);
+				frequencies.resize(size);
+				phases.resize(size);
+			}
+		};
+
+		static float Blend(const float start, const float end, const float w) {
+			return start + (end - start) * w;
+		}
+
+		static sf::Vector2f Blend(const sf::Vector2f& start, const sf::Vector2f& end, const float w) {
+			return { Blend(start.x, end.x, w), Blend(start.y, end.y, w) };
+		}
+
+		static sf::Color Blend(const sf::Color& start, const sf::Color& end, const float w) {
+			return {
+				static_cast<sf::Uint8>(Blend(start.r, end.r, w) + 0.5f),
+				static_cast<sf::Uint8>(Blend(start.g, end.g, w) + 0.5f),
+				static_cast<sf::Uint8>(Blend(start.b, end.b, w) + 0.5f),
+				static_cast<sf::Uint8>(Blend(start.a, end.a, w) + 0.5f)
+			};
+		}
+
+		template <typename T>
+		static void Write(T* target, const T& value) { *target = value; }
+
+		static void Write(const VertexRange& target, const sf::Color& value) {
+			for (std::size_t i = 0; i < target.count; ++i) {
+				target.first[i].color = value;
+			}
+		}
+
+		template <typename T>
+		static const void* Address(T* target) { return target; }
+
+		static const void* Address(const VertexRange& target) { return target.first; }
+
+		template <class L>
+		static L& GetLane(std::array<L, EasingCount>& lanes, const Easing easing) {
+			return lanes[static_cast<std::size_t>(easing)];
+		}
+
+		std::array<Lane<float, float*>, EasingCount> m_floats;
+		std::array<Lane<sf::Vector2f, sf::Vector2f*>, EasingCount> m_vectors;
+		std::array<Lane<sf::Color, sf::Color*>, EasingCount> m_colors;
+		std::array<Lane<sf::Color, VertexRange>, EasingCount> m_vertexColors;
+		std::vector<float> m_weights;
+	};
+
+}
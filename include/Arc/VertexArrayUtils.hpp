@@ -36,6 +36,7 @@
 	-	ShearVertexArray()
 	-	ReflectVertexArrayAlongX()
 	-	ReflectVertexArrayAlongY()
+	-	ApplyTransform()
 
 	------------------------------------------------------------
 			SETTERS
@@ -57,84 +58,309 @@
 
 */
 
-#include "Mathematics.hpp"
+#include "Affine.hpp"
+#include "Profiling.hpp"
+#include "VertexSpan.hpp"
+#include "VertexTraits.hpp"
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <algorithm>
 #include <limits>
 #include <cstddef>
+#include <utility>
 
 namespace Arc {
 
+	// NOTE:
+	// - every function has three forms. the (vertices, start, count) templates take any
+	//   container with operator[] and forward to the span form when the container stores its
+	//   vertices contiguously (see IsContiguousVertexContainer), so sf::VertexArray and
+	//   std::vector<sf::Vertex> only pay for one operator[] per call instead of one per vertex
+	// - any other vertex type goes through Arc::VertexTraits, which is how the packed
+	//   vertices in PackedVertex.hpp are supported
+	// - the span forms take an Arc::VertexSpan and the view forms take a strided view over
+	//   one attribute. the view forms are where the loops live and they are written so the
+	//   compiler can vectorize them
+
 	//////////////////////////////////////////////////////////////////////
 	//	TRASNFORMS
 	//////////////////////////////////////////////////////////////////////
 
-	template <class V>
-	void MoveVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& translation) {
-		std::size_t idx = start;
+	inline void MoveVertexArray(const Vector2fView& positions, const sf::Vector2f& translation) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		const sf::Vector2f t = translation;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			vertices[idx].position += translation;
-			++idx;
+			positions[i] += t;
 		}
 	}
 
+	inline void MoveVertexArray(const VertexSpan& vertices, const sf::Vector2f& translation) {
+		MoveVertexArray(GetPositions(vertices), translation);
+	}
+
 	template <class V>
-	void RotateVertexArray(V& vertices, const std::size_t start, const std::size_t count, const float angle, const sf::Vector2f& center = {}) {
-		std::size_t idx = start;
+	void MoveVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& translation) {
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			MoveVertexArray(MakeVertexSpan(vertices, start, count), translation);
+		}
+		else if constexpr (HasPositionDeltaV<VertexTraitsOf<V>>) {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			const auto delta = Traits::ToPositionDelta(translation);
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				Traits::MovePosition(vertices[idx], delta);
+				++idx;
+			}
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				Traits::SetPosition(vertices[idx], Traits::GetPosition(vertices[idx]) + translation);
+				++idx;
+			}
+		}
+	}
+
+	inline void RotateVertexArray(const Vector2fView& positions, const float angle, const sf::Vector2f& center = {}) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
 		const float theta = Radians(angle);
 		const float sin = std::sin(theta);
 		const float cos = std::cos(theta);
+		const sf::Vector2f c = center;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			RotatePoint(vertices[idx].position, sin, cos, center);
-			++idx;
+			RotatePoint(positions[i], sin, cos, c);
 		}
 	}
 
+	inline void RotateVertexArray(const VertexSpan& vertices, const float angle, const sf::Vector2f& center = {}) {
+		RotateVertexArray(GetPositions(vertices), angle, center);
+	}
+
 	template <class V>
-	void ScaleVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
-		std::size_t idx = start;
+	void RotateVertexArray(V& vertices, const std::size_t start, const std::size_t count, const float angle, const sf::Vector2f& center = {}) {
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			RotateVertexArray(MakeVertexSpan(vertices, start, count), angle, center);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			const float theta = Radians(angle);
+			const float sin = std::sin(theta);
+			const float cos = std::cos(theta);
+			for (std::size_t i = 0; i < count; ++i) {
+				sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				RotatePoint(p, sin, cos, center);
+				Traits::SetPosition(vertices[idx], p);
+				++idx;
+			}
+		}
+	}
+
+	inline void ScaleVertexArray(const Vector2fView& positions, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		const sf::Vector2f s = scaleFactor;
+		const sf::Vector2f c = center;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			ScalePoint(vertices[idx].position, scaleFactor, center);
-			++idx;
+			ScalePoint(positions[i], s, c);
 		}
 	}
 
+	inline void ScaleVertexArray(const VertexSpan& vertices, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
+		ScaleVertexArray(GetPositions(vertices), scaleFactor, center);
+	}
+
 	template <class V>
-	void TransformVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& translation, const float angle, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
-		std::size_t idx = start;
+	void ScaleVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ScaleVertexArray(MakeVertexSpan(vertices, start, count), scaleFactor, center);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				ScalePoint(p, scaleFactor, center);
+				Traits::SetPosition(vertices[idx], p);
+				++idx;
+			}
+		}
+	}
+
+	inline void TransformVertexArray(const Vector2fView& positions, const sf::Vector2f& translation, const float angle, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
 		const float theta = Radians(angle);
 		const float sin = std::sin(theta);
 		const float cos = std::cos(theta);
+		const sf::Vector2f t = translation;
+		const sf::Vector2f s = scaleFactor;
+		const sf::Vector2f c = center;
+		const std::size_t count = positions.size();
+		for (std::size_t i = 0; i < count; ++i) {
+			TransformPoint(positions[i], t, sin, cos, s, c);
+		}
+	}
+
+	inline void TransformVertexArray(const VertexSpan& vertices, const sf::Vector2f& translation, const float angle, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
+		TransformVertexArray(GetPositions(vertices), translation, angle, scaleFactor, center);
+	}
+
+	template <class V>
+	void TransformVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& translation, const float angle, const sf::Vector2f& scaleFactor, const sf::Vector2f& center = {}) {
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			TransformVertexArray(MakeVertexSpan(vertices, start, count), translation, angle, scaleFactor, center);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			const float theta = Radians(angle);
+			const float sin = std::sin(theta);
+			const float cos = std::cos(theta);
+			for (std::size_t i = 0; i < count; ++i) {
+				sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				TransformPoint(p, translation, sin, cos, scaleFactor, center);
+				Traits::SetPosition(vertices[idx], p);
+				++idx;
+			}
+		}
+	}
+
+	inline void ShearVertexArray(const Vector2fView& positions, const sf::Vector2f& shearFactor, const sf::Vector2f& center = {}) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		const sf::Vector2f s = shearFactor;
+		const sf::Vector2f c = center;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			TransformPoint(vertices[idx].position, translation, sin, cos, scaleFactor, center);
-			++idx;
+			ShearPoint(positions[i], s, c);
 		}
 	}
 
+	inline void ShearVertexArray(const VertexSpan& vertices, const sf::Vector2f& shearFactor, const sf::Vector2f& center = {}) {
+		ShearVertexArray(GetPositions(vertices), shearFactor, center);
+	}
+
 	template <class V>
 	void ShearVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& shearFactor, const sf::Vector2f& center = {}) {
-		std::size_t idx = start;
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ShearVertexArray(MakeVertexSpan(vertices, start, count), shearFactor, center);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				ShearPoint(p, shearFactor, center);
+				Traits::SetPosition(vertices[idx], p);
+				++idx;
+			}
+		}
+	}
+
+	inline void ReflectVertexArrayAlongX(const Vector2fView& positions, const sf::Vector2f& center = {}) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		const sf::Vector2f c = center;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			ShearPoint(vertices[idx].position, shearFactor, center);
-			++idx;
+			ReflectPointAlongX(positions[i], c);
 		}
 	}
 
+	inline void ReflectVertexArrayAlongX(const VertexSpan& vertices, const sf::Vector2f& center = {}) {
+		ReflectVertexArrayAlongX(GetPositions(vertices), center);
+	}
+
 	template <class V>
 	void ReflectVertexArrayAlongX(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& center = {}) {
-		std::size_t idx = start;
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ReflectVertexArrayAlongX(MakeVertexSpan(vertices, start, count), center);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				ReflectPointAlongX(p, center);
+				Traits::SetPosition(vertices[idx], p);
+				++idx;
+			}
+		}
+	}
+
+	inline void ReflectVertexArrayAlongY(const Vector2fView& positions, const sf::Vector2f& center = {}) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		const sf::Vector2f c = center;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			ReflectPointAlongX(vertices[idx].position, center);
-			++idx;
+			ReflectPointAlongY(positions[i], c);
 		}
 	}
 
+	inline void ReflectVertexArrayAlongY(const VertexSpan& vertices, const sf::Vector2f& center = {}) {
+		ReflectVertexArrayAlongY(GetPositions(vertices), center);
+	}
+
 	template <class V>
 	void ReflectVertexArrayAlongY(V& vertices, const std::size_t start, const std::size_t count, const sf::Vector2f& center = {}) {
-		std::size_t idx = start;
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ReflectVertexArrayAlongY(MakeVertexSpan(vertices, start, count), center);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				ReflectPointAlongY(p, center);
+				Traits::SetPosition(vertices[idx], p);
+				++idx;
+			}
+		}
+	}
+
+	// NOTE:
+	// - combine any number of transforms into one Arc::Affine2 first and
+	//   this applies all of them in a single pass over the vertices
+	inline void ApplyTransform(const Vector2fView& positions, const Affine2& transform) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		const float a = transform.a, b = transform.b, tx = transform.tx;
+		const float c = transform.c, d = transform.d, ty = transform.ty;
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			ReflectPointAlongY(vertices[idx].position, center);
-			++idx;
+			const sf::Vector2f p = positions[i];
+			positions[i] = { a * p.x + b * p.y + tx, c * p.x + d * p.y + ty };
+		}
+	}
+
+	inline void ApplyTransform(const VertexSpan& vertices, const Affine2& transform) {
+		ApplyTransform(GetPositions(vertices), transform);
+	}
+
+	template <class V>
+	void ApplyTransform(V& vertices, const std::size_t start, const std::size_t count, const Affine2& transform) {
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ApplyTransform(MakeVertexSpan(vertices, start, count), transform);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			const float a = transform.a, b = transform.b, tx = transform.tx;
+			const float c = transform.c, d = transform.d, ty = transform.ty;
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				const sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				Traits::SetPosition(vertices[idx], { a * p.x + b * p.y + tx, c * p.x + d * p.y + ty });
+				++idx;
+			}
 		}
 	}
 
@@ -142,13 +368,42 @@ namespace Arc {
 	//	SETTERS
 	//////////////////////////////////////////////////////////////////////
 
+	inline void SetVertexArrayColor(const ColorView& colors, const sf::Color& color) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, colors.size());
+		const sf::Color c = color;
+		const std::size_t count = colors.size();
+		for (std::size_t i = 0; i < count; ++i) {
+			colors[i] = c;
+		}
+	}
+
+	inline void SetVertexArrayColor(const VertexSpan& vertices, const sf::Color& color) {
+		SetVertexArrayColor(GetColors(vertices), color);
+	}
+
 	template <class V>
 	void SetVertexArrayColor(V& vertices, const std::size_t start, const std::size_t count, const sf::Color& color) {
-		std::size_t idx = start;
-		for (std::size_t i = 0; i < count; ++i) {
-			vertices[idx].color = color;
-			++idx;
+		static_assert(HasColorV<V>, "palette index vertices take colors through SetVertexArrayColorIndex() and SetQuadColorIndex()");
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			SetVertexArrayColor(MakeVertexSpan(vertices, start, count), color);
 		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				Traits::SetColor(vertices[idx], color);
+				++idx;
+			}
+		}
+	}
+
+	inline void SetVertexArrayPosition(const Vector2fView& positions, const sf::Vector2f& position, const sf::Vector2f& center = {}) {
+		MoveVertexArray(positions, position - center);
+	}
+
+	inline void SetVertexArrayPosition(const VertexSpan& vertices, const sf::Vector2f& position, const sf::Vector2f& center = {}) {
+		MoveVertexArray(GetPositions(vertices), position - center);
 	}
 
 	template <class V>
@@ -160,43 +415,107 @@ namespace Arc {
 	//	GETTERS
 	//////////////////////////////////////////////////////////////////////
 
-	template <class V>
-	sf::FloatRect GetVertexArrayBounds(const V& vertices, const std::size_t start, const std::size_t count) {
+	inline sf::FloatRect GetVertexArrayBounds(const ConstVector2fView& positions) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, positions.size());
+		if (positions.empty()) { return {}; }
 		float minX = std::numeric_limits<float>::max();
 		float minY = std::numeric_limits<float>::max();
-		float maxX = std::numeric_limits<float>::min();
-		float maxY = std::numeric_limits<float>::min();
-		std::size_t idx = start;
+		float maxX = std::numeric_limits<float>::lowest();
+		float maxY = std::numeric_limits<float>::lowest();
+		const std::size_t count = positions.size();
 		for (std::size_t i = 0; i < count; ++i) {
-			minX = std::min(minX, vertices[idx].position.x);
-			minY = std::min(minX, vertices[idx].position.y);
-			maxX = std::max(maxX, vertices[idx].position.x);
-			maxY = std::max(maxX, vertices[idx].position.y);
+			const sf::Vector2f p = positions[i];
+			minX = std::min(minX, p.x);
+			minY = std::min(minY, p.y);
+			maxX = std::max(maxX, p.x);
+			maxY = std::max(maxY, p.y);
 		}
 		return { minX, minY, maxX - minX, maxY - minY };
 	}
 
+	inline sf::FloatRect GetVertexArrayBounds(const ConstVertexSpan& vertices) {
+		return GetVertexArrayBounds(GetPositions(vertices));
+	}
+
+	template <class V>
+	sf::FloatRect GetVertexArrayBounds(const V& vertices, const std::size_t start, const std::size_t count) {
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			return GetVertexArrayBounds(ConstVertexSpan(MakeVertexSpan(vertices, start, count)));
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			if (count == 0) { return {}; }
+			float minX = std::numeric_limits<float>::max();
+			float minY = std::numeric_limits<float>::max();
+			float maxX = std::numeric_limits<float>::lowest();
+			float maxY = std::numeric_limits<float>::lowest();
+			using Traits = VertexTraitsOf<V>;
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				const sf::Vector2f p = Traits::GetPosition(vertices[idx]);
+				minX = std::min(minX, p.x);
+				minY = std::min(minY, p.y);
+				maxX = std::max(maxX, p.x);
+				maxY = std::max(maxY, p.y);
+				++idx;
+			}
+			return { minX, minY, maxX - minX, maxY - minY };
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////
 	//	MISC
 	//////////////////////////////////////////////////////////////////////
 
+	inline void ResetVertexArray(const VertexSpan& vertices, const sf::Vertex& defaultVtx = { {}, sf::Color::Transparent, {} }) {
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, vertices.size());
+		std::fill(vertices.begin(), vertices.end(), defaultVtx);
+	}
+
 	template <class V>
 	void ResetVertexArray(V& vertices, const std::size_t start, const std::size_t count, const sf::Vertex& defaultVtx = { {}, sf::Color::Transparent, {} }) {
-		std::size_t idx = start;
+		if constexpr (IsContiguousVertexContainerV<V>) {
+			ResetVertexArray(MakeVertexSpan(vertices, start, count), defaultVtx);
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			const VertexTypeOf<V> vtx = VertexTraitsOf<V>::FromVertex(defaultVtx);
+			std::size_t idx = start;
+			for (std::size_t i = 0; i < count; ++i) {
+				vertices[idx] = vtx;
+				++idx;
+			}
+		}
+	}
+
+	// NOTE:
+	// - only the first min(vtx1.size(), vtx2.size()) vertices are swapped
+	// - the spans may overlap (SwapVertiesInArray() does that). vertices are swapped one
+	//   pair at a time from the front, same as the container form
+	inline void SwapVertexArrays(const VertexSpan& vtx1, const VertexSpan& vtx2) {
+		const std::size_t count = std::min(vtx1.size(), vtx2.size());
+		ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+		sf::Vertex* const data1 = vtx1.data();
+		sf::Vertex* const data2 = vtx2.data();
 		for (std::size_t i = 0; i < count; ++i) {
-			vertices[idx] = defaultVtx;
-			++idx;
+			std::swap(data1[i], data2[i]);
 		}
 	}
 
 	template <class V1, class V2>
 	void SwapVertexArrays(V1& vtx1, const std::size_t start1, V2& vtx2, const std::size_t start2, const std::size_t count) {
-		std::size_t idx1 = start1;
-		std::size_t idx2 = start2;
-		for (std::size_t i = 0; i < count; ++i) {
-			std::swap(vtx1[idx1], vtx2[idx2]);
-			++idx1;
-			++idx2;
+		if constexpr (IsContiguousVertexContainerV<V1> && IsContiguousVertexContainerV<V2>) {
+			SwapVertexArrays(MakeVertexSpan(vtx1, start1, count), MakeVertexSpan(vtx2, start2, count));
+		}
+		else {
+			ARC_PROFILE_COUNT(ProfileCounter::VertexArrayVertices, count);
+			std::size_t idx1 = start1;
+			std::size_t idx2 = start2;
+			for (std::size_t i = 0; i < count; ++i) {
+				std::swap(vtx1[idx1], vtx2[idx2]);
+				++idx1;
+				++idx2;
+			}
 		}
 	}
 
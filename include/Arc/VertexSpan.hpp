@@ -0,0 +1,228 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CORE FUNCTIONS
+	------------------------------------------------------------
+	-	GetVertexData()
+	-	MakeVertexSpan()
+	-	GetVertexAttributes()
+	-	GetPositions()
+	-	GetColors()
+	-	GetTexCoords()
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	data()
+	-	size()
+	-	empty()
+	-	begin()
+	-	end()
+	-	Subspan()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		std::vector<sf::Vertex> vertices(400);
+
+		// a span is just a pointer and a count. every function in VertexArrayUtils has an overload for it
+		Arc::VertexSpan span = Arc::MakeVertexSpan(vertices, 100, 200);
+		Arc::SetVertexArrayColor(span, sf::Color::Red);
+
+		// views only see one attribute of each vertex. this scrolls the texture coordinates
+		// with the same function that would move the positions
+		Arc::MoveVertexArray(Arc::GetTexCoords(span), { 0.5f, 0.0f });
+
+	}
+
+*/
+
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace Arc {
+
+	//////////////////////////////////////////////////////////////////////
+	//	SPANS
+	//////////////////////////////////////////////////////////////////////
+
+	template <class T>
+	class BasicVertexSpan {
+	public:
+
+		constexpr BasicVertexSpan() = default;
+
+		constexpr BasicVertexSpan(T* data, const std::size_t size) : m_data(data), m_size(size) {}
+
+		// allows a VertexSpan to be passed where a ConstVertexSpan is expected
+		template <class U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		constexpr BasicVertexSpan(const BasicVertexSpan<U>& other) : m_data(other.data()), m_size(other.size()) {}
+
+		constexpr T* data() const { return m_data; }
+		constexpr std::size_t size() const { return m_size; }
+		constexpr bool empty() const { return m_size == 0; }
+		constexpr T* begin() const { return m_data; }
+		constexpr T* end() const { return m_data + m_size; }
+		constexpr T& operator [] (const std::size_t index) const { return m_data[index]; }
+
+		constexpr BasicVertexSpan Subspan(const std::size_t start, const std::size_t count) const {
+			return { m_data + start, count };
+		}
+
+	private:
+		T* m_data = nullptr;
+		std::size_t m_size = 0;
+	};
+
+	using VertexSpan = BasicVertexSpan<sf::Vertex>;
+	using ConstVertexSpan = BasicVertexSpan<const sf::Vertex>;
+
+	//////////////////////////////////////////////////////////////////////
+	//	STRIDED VIEWS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - the stride is a template parameter so the compiler sees a fixed layout
+	//   and can still vectorize loops over one attribute of a vertex
+	// - S defaults to the size of sf::Vertex. any other struct that stores the
+	//   attribute at a fixed offset works by passing its size as S
+	template <class T, std::size_t S = sizeof(sf::Vertex)>
+	class StridedView {
+	public:
+
+		using Byte = std::conditional_t<std::is_const_v<T>, const unsigned char, unsigned char>;
+
+		constexpr StridedView() = default;
+
+		constexpr StridedView(Byte* first, const std::size_t size) : m_first(first), m_size(size) {}
+
+		template <class U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		constexpr StridedView(const StridedView<U, S>& other) : m_first(other.GetFirstByte()), m_size(other.size()) {}
+
+		constexpr std::size_t size() const { return m_size; }
+		constexpr bool empty() const { return m_size == 0; }
+		constexpr Byte* GetFirstByte() const { return m_first; }
+
+		T& operator [] (const std::size_t index) const {
+			return *reinterpret_cast<T*>(m_first + index * S);
+		}
+
+	private:
+		Byte* m_first = nullptr;
+		std::size_t m_size = 0;
+	};
+
+	// texture coordinates and positions are both sf::Vector2f so they share a view type
+	using Vector2fView = StridedView<sf::Vector2f>;
+	using ConstVector2fView = StridedView<const sf::Vector2f>;
+	using ColorView = StridedView<sf::Color>;
+	using ConstColorView = StridedView<const sf::Color>;
+
+	// NOTE:
+	// - returns a view over the attribute stored offset bytes into each vertex. the
+	//   views are const when the span is
+	template <class A, class T>
+	StridedView<std::conditional_t<std::is_const_v<T>, const A, A>> GetVertexAttributes(const BasicVertexSpan<T>& vertices, const std::size_t offset) {
+		using View = StridedView<std::conditional_t<std::is_const_v<T>, const A, A>>;
+		return View(reinterpret_cast<typename View::Byte*>(vertices.data()) + offset, vertices.size());
+	}
+
+	template <class T>
+	auto GetPositions(const BasicVertexSpan<T>& vertices) {
+		return GetVertexAttributes<sf::Vector2f>(vertices, offsetof(sf::Vertex, position));
+	}
+
+	template <class T>
+	auto GetColors(const BasicVertexSpan<T>& vertices) {
+		return GetVertexAttributes<sf::Color>(vertices, offsetof(sf::Vertex, color));
+	}
+
+	template <class T>
+	auto GetTexCoords(const BasicVertexSpan<T>& vertices) {
+		return GetVertexAttributes<sf::Vector2f>(vertices, offsetof(sf::Vertex, texCoords));
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//	CONTAINERS
+	//////////////////////////////////////////////////////////////////////
+
+	// NOTE:
+	// - true for containers whose vertices are known to be stored one after another:
+	//   anything with a data() member returning sf::Vertex* (std::vector, std::array, spans),
+	//   built-in arrays, raw pointers and sf::VertexArray (which stores a std::vector)
+	template <class V, typename = void>
+	struct IsContiguousVertexContainer : std::false_type {};
+
+	template <class V>
+	struct IsContiguousVertexContainer<V, std::void_t<decltype(std::declval<V&>().data())>>
+		: std::is_same<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<V&>().data())>>, sf::Vertex> {};
+
+	template <>
+	struct IsContiguousVertexContainer<sf::VertexArray> : std::true_type {};
+
+	template <>
+	struct IsContiguousVertexContainer<sf::Vertex*> : std::true_type {};
+
+	template <>
+	struct IsContiguousVertexContainer<const sf::Vertex*> : std::true_type {};
+
+	template <std::size_t N>
+	struct IsContiguousVertexContainer<sf::Vertex[N]> : std::true_type {};
+
+	template <class V>
+	constexpr bool IsContiguousVertexContainerV = IsContiguousVertexContainer<std::remove_const_t<V>>::value;
+
+	template <class V>
+	auto GetVertexData(V& vertices) {
+		if constexpr (std::is_same_v<std::remove_const_t<V>, sf::VertexArray>) {
+			return vertices.getVertexCount() == 0 ? nullptr : &vertices[0];
+		}
+		else if constexpr (std::is_pointer_v<V>) {
+			return vertices;
+		}
+		else {
+			return std::data(vertices);
+		}
+	}
+
+	template <class V>
+	auto MakeVertexSpan(V& vertices, const std::size_t start, const std::size_t count) {
+		static_assert(IsContiguousVertexContainerV<V>, "the container does not store its vertices contiguously");
+		auto* data = GetVertexData(vertices);
+		return BasicVertexSpan<std::remove_pointer_t<decltype(data)>>(data + start, count);
+	}
+
+}
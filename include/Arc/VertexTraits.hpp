@@ -0,0 +1,117 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASSES
+	------------------------------------------------------------
+	-	VertexTraits
+	-	HasPositionDelta
+
+	------------------------------------------------------------
+			CORE FUNCTIONS
+	------------------------------------------------------------
+	-	HasColorV
+
+	------------------------------------------------------------
+			STATIC MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	GetPosition()
+	-	SetPosition()
+	-	GetColor()
+	-	SetColor()
+	-	GetTexCoords()
+	-	SetTexCoords()
+	-	FromVertex()
+	-	ToPositionDelta() (optional)
+	-	MovePosition() (optional)
+
+*/
+
+#include <SFML/Graphics/Vertex.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace Arc {
+
+	// NOTE:
+	// - this is how VertexArrayUtils and QuadUtils read and write vertices so they work
+	//   on vertex types other than sf::Vertex. the default works for any struct with
+	//   sf::Vector2f position and texCoords members and an sf::Color color member
+	// - specialize it for vertex types that store their attributes differently
+	//   (see PackedVertex.hpp). positions and texture coordinates always go in and
+	//   come out as sf::Vector2f
+	template <class V>
+	struct VertexTraits {
+
+		using ColorType = sf::Color;
+
+		static sf::Vector2f GetPosition(const V& vertex) { return vertex.position; }
+		static void SetPosition(V& vertex, const sf::Vector2f& position) { vertex.position = position; }
+
+		static sf::Color GetColor(const V& vertex) { return vertex.color; }
+		static void SetColor(V& vertex, const sf::Color& color) { vertex.color = color; }
+
+		static sf::Vector2f GetTexCoords(const V& vertex) { return vertex.texCoords; }
+		static void SetTexCoords(V& vertex, const sf::Vector2f& texCoords) { vertex.texCoords = texCoords; }
+
+		static V FromVertex(const sf::Vertex& vertex) {
+			V result;
+			SetPosition(result, vertex.position);
+			SetColor(result, vertex.color);
+			SetTexCoords(result, vertex.texCoords);
+			return result;
+		}
+
+	};
+
+	// the vertex type stored in a container, e.g. sf::Vertex for sf::VertexArray
+	template <class V>
+	using VertexTypeOf = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<V&>()[0])>>;
+
+	template <class V>
+	using VertexTraitsOf = VertexTraits<VertexTypeOf<V>>;
+
+	// true when the vertices in V store an sf::Color, which is what every color setter writes.
+	// palette index vertices (see PackedVertex.hpp) are false
+	template <class V>
+	constexpr bool HasColorV = std::is_same_v<typename VertexTraitsOf<V>::ColorType, sf::Color>;
+
+	// NOTE:
+	// - a specialization can also give ToPositionDelta() and MovePosition() so that
+	//   MoveVertexArray() converts the translation once and then moves every vertex
+	//   in its own format instead of going through sf::Vector2f
+	template <class Traits, typename = void>
+	struct HasPositionDelta : std::false_type {};
+
+	template <class Traits>
+	struct HasPositionDelta<Traits, std::void_t<decltype(Traits::ToPositionDelta(std::declval<const sf::Vector2f&>()))>> : std::true_type {};
+
+	template <class Traits>
+	constexpr bool HasPositionDeltaV = HasPositionDelta<Traits>::value;
+
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//																											  //
+//  Arc - SFML Vertex Array Utilities																		  //
+//  Copyright (C) 2021 - 2022 Kan																					  //
+//    																										  //
+//  This software is provided 'as-is', without any express or implied warranty.								  //
+//  In no event will the authors be held liable for any damages arising from the use of this software.		  //
+//																											  //
+//  Permission is granted to anyone to use this software for any purpose, including commercial applications,  //
+//  and to alter it and redistribute it freely, subject to the following restrictions:						  //
+//																											  //
+//		1.  The origin of this software must not be misrepresented;											  //
+//			you must not claim that you wrote the original software.										  //
+//			If you use this software in a product, an acknowledgment										  //
+//			in the product documentation would be appreciated but											  //
+//			is not required.																				  //
+//																											  //
+//		2.  Altered source versions must be plainly marked as such,											  //
+//			and must not be misrepresented as being the original software.									  //
+//																											  //
+//		3.  This notice may not be removed or altered from any source distribution.							  //
+//																											  //
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+	------------------------------------------------------------
+			CLASS MEMBER FUNCTIONS
+	------------------------------------------------------------
+	-	GetBackBuffer()
+	-	MarkDirty()
+	-	MarkAllDirty()
+	-	Resize()
+	-	Publish()
+	-	Acquire()
+	-	GetFrontBuffer()
+	-	Draw()
+
+	------------------------------------------------------------
+			BASIC USAGE
+	------------------------------------------------------------
+
+	int main() {
+
+		Arc::VertexTripleBuffer vertices(100 * 4);
+		std::atomic<bool> running = true;
+
+		// the simulation thread only touches the back buffer
+		std::thread simulation([&]() {
+			while (running) {
+				std::vector<sf::Vertex>& back = vertices.GetBackBuffer();
+				Arc::MoveQuad(back, 7, { 1.0f, 0.0f });
+				vertices.MarkDirty(7 * 4, 4); // tell the buffer which vertices changed this frame
+				vertices.Publish();
+			}
+		});
+
+		// the render thread only touches the front buffer
+		while (window.isOpen()) {
+			vertices.Acquire(); // keeps the previous frame if no new one was published
+			window.clear();
+			vertices.Draw(window);
+			window.display();
+		}
+
+		running = false;
+		simulation.join();
+
+	}
+
+*/
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+namespace Arc {
+
+	// NOTE:
+	// - three buffers: the back buffer owned by the writer, the front buffer owned by the reader
+	//   and the ready buffer in between. Publish() and Acquire() each swap their buffer with the
+	//   ready one using a single atomic exchange so neither thread ever waits on the other
+	// - swapping only exchanges buffer indices. no vertices are copied on the reader's side
+	// - the buffer handed back to the writer after Publish() is a few frames old. the ranges
+	//   marked dirty since it was last written are copied into it from the newest frame, so
+	//   the writer always continues from the latest state and only changed vertices are copied
+	// - GetBackBuffer(), MarkDirty(), Resize() and Publish() must only be called from one thread
+	//   and Acquire(), GetFrontBuffer() and Draw() from one other thread
+	template <class V = sf::Vertex>
+	class BasicVertexTripleBuffer {
+	public:
+
+		using Buffer = std::vector<V>;
+
+		explicit BasicVertexTripleBuffer(const std::size_t count = 0, const sf::PrimitiveType type = sf::Quads) : m_type(type) {
+			for (Buffer& buffer : m_buffers) { buffer.resize(count); }
+		}
+
+		BasicVertexTripleBuffer(const BasicVertexTripleBuffer&) = delete;
+		BasicVertexTripleBuffer& operator=(const BasicVertexTripleBuffer&) = delete;
+
+		// writer thread
+		Buffer& GetBackBuffer() { return m_buffers[m_back]; }
+
+		// writer thread. changes outside the marked ranges are lost once the buffer is handed back
+		void MarkDirty(const std::size_t start, const std::size_t count) {
+			if (count == 0) { return; }
+			m_dirty.Add(start, start + count);
+		}
+
+		void MarkAllDirty() {
+			MarkDirty(0, m_buffers[m_back].size());
+		}
+
+		// writer thread. new vertices are marked dirty, the other buffers are resized when they are next written
+		void Resize(const std::size_t count) {
+			Buffer& back = m_buffers[m_back];
+			const std::size_t previous = back.size();
+			back.resize(count);
+			if (count > previous) { MarkDirty(previous, count - previous); }
+		}
+
+		// writer thread. makes the back buffer the newest frame and brings the next back buffer up to date
+		void Publish() {
+			const unsigned published = m_back;
+			for (unsigned i = 0; i < 3; ++i) {
+				if (i != published) { m_stale[i].Add(m_dirty); }
+			}
+			m_dirty = {};
+			m_back = m_ready.exchange(published | FreshBit, std::memory_order_acq_rel) & IndexMask;
+
+			// the published buffer may be read by the render thread at the same time, which is fine since both only read it
+			const Buffer& source = m_buffers[published];
+			Buffer& back = m_buffers[m_back];
+			Range& stale = m_stale[m_back];
+			if (back.size() != source.size()) { back.resize(source.size()); }
+			const std::size_t end = std::min(stale.end, source.size());
+			if (stale.start < end) { std::copy(source.begin() + stale.start, source.begin() + end, back.begin() + stale.start); }
+			stale = {};
+		}
+
+		// reader thread. returns false and keeps the current front buffer if nothing new was published
+		bool Acquire() {
+			if ((m_ready.load(std::memory_order_relaxed) & FreshBit) == 0) { return false; }
+			m_front = m_ready.exchange(m_front, std::memory_order_acq_rel) & IndexMask;
+			return true;
+		}
+
+		// reader thread
+		const Buffer& GetFrontBuffer() const { return m_buffers[m_front]; }
+
+		// reader thread
+		void Draw(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default) const {
+			static_assert(std::is_same_v<V, sf::Vertex>, "expand packed vertices before drawing them");
+			const Buffer& front = m_buffers[m_front];
+			if (!front.empty()) { target.draw(front.data(), front.size(), m_type, states); }
+		}
+
+	private:
+
+		static constexpr unsigned IndexMask = 3;
+		static constexpr unsigned FreshBit = 4;
+
+		// one range covering every change keeps the bookkeeping to two compares per MarkDirty()
+		struct Range {
+			std::size_t start = 0;
+			std::size_t end = 0;
+
+			void Add(const std::size_t first, const std::size_t last) {
+				if (start == end) { start = first; end = last; return; }
+				start = std::min(start, first);
+				end = std::max(end, last);
+			}
+
+			void Add(const Range& other) {
+				if (other.start != other.end) { Add(other.start, other.end); }
+			}
+		};
+
+		std::array<Buffer, 3> m_buffers;
+		std::array<Range, 3> m_stale; // changes each buffer is missing. only used by the writer
+		Range m_dirty; // changes made to the back buffer this frame
+		sf::PrimitiveType m_type;
+
+		// each thread's index sits on its own cache line so the threads do not slow each other down
+		alignas(64) unsigned m_back = 0;
+		alignas(64) std::atomic<unsigned> m_ready{ 1 };
+		alignas(64) unsigned m_front = 2;
+	};
+
+	using VertexTripleBuffer = BasicVertexTripleBuffer<>;
+
+}